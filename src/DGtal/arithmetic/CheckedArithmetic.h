@@ -0,0 +1,160 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file CheckedArithmetic.h
+ *
+ * @author DGtal development team (\c dgtal-devel@lists.gforge.liris.cnrs.fr )
+ *
+ * @date 2026/10/19
+ *
+ * Header file for module CheckedArithmetic.cpp
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(CheckedArithmetic_RECURSES)
+#error Recursive header files inclusion detected in CheckedArithmetic.h
+#else // defined(CheckedArithmetic_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define CheckedArithmetic_RECURSES
+
+#if !defined CheckedArithmetic_h
+/** Prevents repeated inclusion of headers. */
+#define CheckedArithmetic_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include "DGtal/base/Common.h"
+#include "DGtal/kernel/NumberTraits.h"
+#include "DGtal/kernel/CInteger.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+  /**
+   * Overflow-checked arithmetic on bounded integers (e.g.
+   * DGtal::int64_t or DGtal::int128_t). Each function computes its
+   * result in the given integer type and tells whether this result
+   * is exact. The determinant signs escalate to a wider integer type
+   * (e.g. DGtal::BigInteger) only when an overflow occurs, so that
+   * the common case does not pay for a multi-precision computation.
+   *
+   * @code
+   DGtal::int128_t r;
+   if ( ! functions::checkedMultiply( a, b, r ) )
+     ... // the product of a and b does not fit in 128 bits.
+
+   // exact, computed with BigInteger only on overflow of int128_t.
+   int s = functions::determinantSign2x2<BigInteger>( a, b, c, d );
+   @endcode
+   */
+  namespace functions
+  {
+    /**
+     * @param a any integer.
+     * @param b any integer.
+     * @param r (returns) a + b, if no overflow occurred.
+     * @return 'true' iff no overflow occurred.
+     * @tparam TInteger a bounded model of CInteger.
+     */
+    template <typename TInteger>
+    bool checkedAdd( TInteger a, TInteger b, TInteger & r );
+
+    /**
+     * @param a any integer.
+     * @param b any integer.
+     * @param r (returns) a - b, if no overflow occurred.
+     * @return 'true' iff no overflow occurred.
+     * @tparam TInteger a bounded model of CInteger.
+     */
+    template <typename TInteger>
+    bool checkedSubtract( TInteger a, TInteger b, TInteger & r );
+
+    /**
+     * @param a any integer.
+     * @param b any integer.
+     * @param r (returns) a * b, if no overflow occurred.
+     * @return 'true' iff no overflow occurred.
+     * @tparam TInteger a bounded model of CInteger.
+     */
+    template <typename TInteger>
+    bool checkedMultiply( TInteger a, TInteger b, TInteger & r );
+
+    /**
+     * @param a,b first row of the matrix.
+     * @param c,d second row of the matrix.
+     * @param r (returns) the determinant a*d - b*c, if no overflow occurred.
+     * @return 'true' iff no overflow occurred.
+     * @tparam TInteger a bounded model of CInteger.
+     */
+    template <typename TInteger>
+    bool checkedDeterminant2x2( TInteger a, TInteger b,
+                                TInteger c, TInteger d, TInteger & r );
+
+    /**
+     * @param m a 3x3 matrix, given row by row.
+     * @param r (returns) its determinant, if no overflow occurred.
+     * @return 'true' iff no overflow occurred.
+     * @tparam TInteger a bounded model of CInteger.
+     */
+    template <typename TInteger>
+    bool checkedDeterminant3x3( const TInteger (&m)[ 3 ][ 3 ], TInteger & r );
+
+    /**
+     * Exact sign of a 2x2 determinant, computed with TInteger and
+     * computed again with TSafeInteger if an overflow occurred.
+     *
+     * @param a,b first row of the matrix.
+     * @param c,d second row of the matrix.
+     * @return the sign of a*d - b*c, ie. -1, 0 or 1.
+     * @tparam TSafeInteger a model of CInteger that can represent
+     * the determinant (e.g. DGtal::BigInteger).
+     * @tparam TInteger a bounded model of CInteger.
+     */
+    template <typename TSafeInteger, typename TInteger>
+    int determinantSign2x2( TInteger a, TInteger b, TInteger c, TInteger d );
+
+    /**
+     * Exact sign of a 3x3 determinant, computed with TInteger and
+     * computed again with TSafeInteger if an overflow occurred.
+     *
+     * @param m a 3x3 matrix, given row by row.
+     * @return the sign of its determinant, ie. -1, 0 or 1.
+     * @tparam TSafeInteger a model of CInteger that can represent
+     * the determinant (e.g. DGtal::BigInteger).
+     * @tparam TInteger a bounded model of CInteger.
+     */
+    template <typename TSafeInteger, typename TInteger>
+    int determinantSign3x3( const TInteger (&m)[ 3 ][ 3 ] );
+
+  } // namespace functions
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/arithmetic/CheckedArithmetic.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined CheckedArithmetic_h
+
+#undef CheckedArithmetic_RECURSES
+#endif // else defined(CheckedArithmetic_RECURSES)
@@ -43,8 +43,10 @@
 //////////////////////////////////////////////////////////////////////////////
 // Inclusions
 #include <iostream>
+#include <mutex>
 #include <vector>
 #include "DGtal/base/Common.h"
+#include "DGtal/base/ObjectPool.h"
 #include "DGtal/base/StdRebinders.h"
 #include "DGtal/base/InputIteratorWithRankOnSequence.h"
 #include "DGtal/kernel/CInteger.h"
@@ -92,6 +94,13 @@ namespace DGtal
    duplicate it. Use static method LightSternBrocot::fraction to obtain
    your fractions.
 
+   The tree may be shared by several threads: nodes are allocated
+   by blocks in an ObjectPool, and the accesses to the maps of
+   children are serialized by a lock. Since every step of the
+   navigation goes through such a map, concurrent threads contend
+   for this lock; SternBrocot, whose links are atomic pointers,
+   scales better in multi-threaded code.
+
    @tparam TInteger the integral type chosen for the fractions.
 
    @tparam TQuotient the integral type chosen for the
@@ -518,8 +527,10 @@ namespace DGtal
     // ------------------------- Private Datas --------------------------------
   private:
 
-    /// Singleton class.
-    static LightSternBrocot* singleton;
+    /// The nodes of the tree.
+    ObjectPool<Node> myNodes;
+    /// Serializes the accesses to the children of the nodes.
+    std::mutex myMutex;
 
 
     // ------------------------- Datas ----------------------------------------
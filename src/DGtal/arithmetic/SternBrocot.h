@@ -42,9 +42,12 @@
 
 //////////////////////////////////////////////////////////////////////////////
 // Inclusions
+#include <atomic>
 #include <iostream>
+#include <mutex>
 #include <vector>
 #include "DGtal/base/Common.h"
+#include "DGtal/base/ObjectPool.h"
 #include "DGtal/base/InputIteratorWithRankOnSequence.h"
 #include "DGtal/kernel/CInteger.h"
 #include "DGtal/kernel/NumberTraits.h"
@@ -67,6 +70,14 @@ namespace DGtal
    duplicate it. Use static method SternBrocot::fraction to obtain
    your fractions.
 
+   The tree may be shared by several threads. Nodes are allocated by
+   blocks in an ObjectPool and are created under a lock, while
+   the links to the descendants are atomic pointers, so that the
+   navigation in the already built part of the tree never locks:
+   since the tree only grows, its upper part is quickly built and
+   most calls to Fraction::left() or Fraction::right() only follow
+   an existing link.
+
    @tparam TInteger the integral type chosen for the fractions.
 
    @tparam TQuotient the integral type chosen for the
@@ -131,9 +142,11 @@ namespace DGtal
       /// the node that is the right ascendant.
       Node* ascendantRight;
       /// the node that is the left descendant or 0 (if none exist).
-      Node* descendantLeft;
+      /// Atomic since it may be created by another thread.
+      std::atomic<Node*> descendantLeft;
       /// the node that is the right descendant or 0 (if none exist).
-      Node* descendantRight;
+      /// Atomic since it may be created by another thread.
+      std::atomic<Node*> descendantRight;
       /// the node that is its inverse.
       Node* inverse;
     };
@@ -464,8 +477,10 @@ namespace DGtal
   private:
     // ------------------------- Private Datas --------------------------------
   private:
-    /// Singleton class.
-    static SternBrocot* singleton;
+    /// The nodes of the tree.
+    ObjectPool<Node> myNodes;
+    /// Serializes the creation of nodes.
+    std::mutex myMutex;
 
     Node* myZeroOverOne;
     Node* myOneOverZero;
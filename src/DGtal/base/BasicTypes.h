@@ -73,6 +73,56 @@ namespace DGtal
   ///signed 94-bit integer.
   typedef boost::int64_t int64_t;
   
+// 128-bit integers are integral types for the standard library (and
+// thus for NumberTraits) only with the GNU extensions (-std=gnu++11).
+#if defined(__SIZEOF_INT128__) && !defined(__STRICT_ANSI__)
+  #define WITH_INT128
+  ///signed 128-bit integer (compiler extension of gcc and clang on
+  ///64-bit platforms).
+  __extension__ typedef __int128 int128_t;
+  ///unsigned 128-bit integer (compiler extension of gcc and clang on
+  ///64-bit platforms).
+  __extension__ typedef unsigned __int128 uint128_t;
+
+  /**
+   * Writes a 128-bit unsigned integer in base 10 (the standard
+   * streams do not handle 128-bit integers).
+   * @param out the output stream where the integer is written.
+   * @param aValue any 128-bit unsigned integer.
+   * @return the output stream after the writing.
+   */
+  inline
+  std::ostream&
+  operator<< ( std::ostream & out, uint128_t aValue )
+  {
+    char buffer[ 40 ];
+    char* p = buffer + sizeof( buffer );
+    *--p = '\0';
+    do
+      {
+        *--p = static_cast<char>( '0' + static_cast<int>( aValue % 10 ) );
+        aValue /= 10;
+      }
+    while ( aValue != 0 );
+    return out << p;
+  }
+
+  /**
+   * Writes a 128-bit signed integer in base 10.
+   * @param out the output stream where the integer is written.
+   * @param aValue any 128-bit signed integer.
+   * @return the output stream after the writing.
+   */
+  inline
+  std::ostream&
+  operator<< ( std::ostream & out, int128_t aValue )
+  {
+    if ( aValue >= 0 ) return out << static_cast<uint128_t>( aValue );
+    // The negation is done on the unsigned type, to handle the minimal value.
+    return out << '-' << ( ~static_cast<uint128_t>( aValue ) + 1 );
+  }
+#endif
+
 #ifdef WITH_GMP
   #define WITH_BIGINTEGER
   ///Multi-precision integer with GMP implementation.
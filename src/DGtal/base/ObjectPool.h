@@ -0,0 +1,161 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file ObjectPool.h
+ *
+ * @author DGtal development team (\c dgtal-devel@lists.gforge.liris.cnrs.fr )
+ *
+ * @date 2026/10/19
+ *
+ * Header file for module ObjectPool.cpp
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(ObjectPool_RECURSES)
+#error Recursive header files inclusion detected in ObjectPool.h
+#else // defined(ObjectPool_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define ObjectPool_RECURSES
+
+#if !defined ObjectPool_h
+/** Prevents repeated inclusion of headers. */
+#define ObjectPool_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <vector>
+#include "DGtal/base/Common.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class ObjectPool
+  /**
+   * Description of template class 'ObjectPool' <p>
+   * \brief Aim: Allocates objects of a given type by blocks of
+   * contiguous memory. Objects are never freed individually: they all
+   * live as long as the pool, and are destroyed with it.
+   *
+   * It is meant for structures that only grow, like the lazily built
+   * Stern-Brocot trees, where allocating each node separately costs a
+   * call to the memory allocator per node and scatters the nodes in
+   * memory. The address of an object never changes, so that pointers
+   * to objects remain valid. The objects need not be copyable nor
+   * movable.
+   *
+   * The pool itself is not thread-safe: concurrent calls to create()
+   * must be serialized by the caller.
+   *
+   * @code
+   ObjectPool<Node> pool;
+   Node* n = pool.create( p, q, father );
+   @endcode
+   *
+   * @tparam T the type of the allocated objects.
+   */
+  template <typename T>
+  class ObjectPool
+  {
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+     * Constructor.
+     * @param aBlockSize the number of objects per block.
+     */
+    ObjectPool( std::size_t aBlockSize = 1024 );
+
+    /**
+     * Destructor. Destroys all the objects and frees the blocks.
+     */
+    ~ObjectPool();
+
+    /**
+     * Constructs a new object in the pool.
+     * @param args the arguments given to the constructor of T.
+     * @return a pointer to the new object, valid as long as the pool.
+     */
+    template <typename... Args>
+    T* create( Args&&... args );
+
+    /// @return the number of objects of the pool.
+    std::size_t size() const;
+
+    /// @return the number of allocated blocks.
+    std::size_t nbBlocks() const;
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+    /// The number of objects per block.
+    std::size_t myBlockSize;
+    /// The blocks of raw memory.
+    std::vector<T*> myBlocks;
+    /// The number of objects in the last block.
+    std::size_t myLastBlockSize;
+
+    // ------------------------- Hidden services ------------------------------
+  private:
+    /// Forbidden copy constructor.
+    ObjectPool( const ObjectPool & other );
+    /// Forbidden assignment.
+    ObjectPool & operator=( const ObjectPool & other );
+
+  }; // end of class ObjectPool
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'ObjectPool'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'ObjectPool' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename T>
+  std::ostream&
+  operator<< ( std::ostream & out, const ObjectPool<T> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/base/ObjectPool.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined ObjectPool_h
+
+#undef ObjectPool_RECURSES
+#endif // else defined(ObjectPool_RECURSES)
@@ -45,12 +45,14 @@
 //////////////////////////////////////////////////////////////////////////////
 // Inclusions
 #include <iostream>
+#include <type_traits>
 #include "DGtal/base/Common.h"
 #include "DGtal/base/ReverseIterator.h"
 #include "DGtal/kernel/SpaceND.h"
 #include "DGtal/geometry/surfaces/ParallelStrip.h"
 #include "DGtal/geometry/tools/MelkmanConvexHull.h"
 #include "DGtal/geometry/tools/determinant/InHalfPlaneBySimple3x3Matrix.h"
+#include "DGtal/geometry/tools/determinant/InHalfSpaceByFilteredDet.h"
 //////////////////////////////////////////////////////////////////////////////
 
 namespace DGtal
@@ -158,7 +160,13 @@ public:
 
   typedef AlphaThickSegmentComputer<InputPoint, ConstIterator> Self;
   typedef AlphaThickSegmentComputer<InputPoint, ReverseIterator<ConstIterator> > Reverse;
-  typedef DGtal::InHalfPlaneBySimple3x3Matrix<InputPoint, typename InputPoint::Component> Functor;
+  /**
+   * Orientation functor of the convex hull: the filtered exact
+   * predicate for integer points, a 3x3 determinant otherwise.
+   */
+  typedef typename std::conditional< std::is_integral<typename InputPoint::Component>::value,
+                                     DGtal::InHalfSpaceByFilteredDet<InputPoint, DGtal::int64_t>,
+                                     DGtal::InHalfPlaneBySimple3x3Matrix<InputPoint, typename InputPoint::Component> >::type Functor;
   typedef typename  DGtal::MelkmanConvexHull<InputPoint, Functor>::ConstIterator ConvexhullConstIterator;
 
   // ----------------------- internal types --------------------------------------
@@ -70,7 +70,10 @@ namespace DGtal
    * @tparam TIterator type of iterator on 2d digital points,
    * at least readable and forward. 
    * @tparam TInteger type of integers used for the computation of remainders, 
-   * which is a model of CInteger.  
+   * which is a model of CInteger. The coordinate type by default: the
+   * remainders of points of coordinates greater than the square root of
+   * its maximal value may overflow, use then a wider type, e.g.
+   * DGtal::int128_t (when WITH_INT128 is defined) or BigInteger.
    * @tparam adjacency an unsigned integer equal to 4 for standard 
    * (simply 4-connected) DSS or 8 for naive (simply 8-connected) DSS (default). 
    *
@@ -449,7 +452,8 @@ namespace DGtal
    * @tparam TIterator type of iterator on 2d digital points,
    * at least readable and forward. 
    * @tparam TInteger type of integers used for the computation of remainders, 
-   * which is a model of CInteger.  
+   * which is a model of CInteger (see ArithmeticalDSSComputer for
+   * the choice of a wider type than the default coordinate type).
    *
    * This class is a model of CDynamicBidirectionalSegmentComputer. 
    * It is also default constructible, copy constructible, assignable and equality comparable. 
@@ -510,7 +514,8 @@ namespace DGtal
    * @tparam TIterator type of iterator on 2d digital points,
    * at least readable and forward. 
    * @tparam TInteger type of integers used for the computation of remainders, 
-   * which is a model of CInteger.  
+   * which is a model of CInteger (see ArithmeticalDSSComputer for
+   * the choice of a wider type than the default coordinate type).
    *
    * This class is a model of CDynamicBidirectionalSegmentComputer. 
    * It is also default constructible, copy constructible, assignable and equality comparable. 
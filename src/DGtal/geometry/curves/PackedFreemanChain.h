@@ -0,0 +1,563 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file PackedFreemanChain.h
+ *
+ * @author DGtal development team (\c dgtal-devel@lists.gforge.liris.cnrs.fr )
+ *
+ * @date 2026/10/19
+ *
+ * @brief Header file for module PackedFreemanChain.ih
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(PackedFreemanChain_RECURSES)
+#error Recursive header files inclusion detected in PackedFreemanChain.h
+#else // defined(PackedFreemanChain_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define PackedFreemanChain_RECURSES
+
+#if !defined PackedFreemanChain_h
+/** Prevents repeated inclusion of headers. */
+#define PackedFreemanChain_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <iterator>
+#include <vector>
+#include <string>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/Bits.h"
+#include "DGtal/base/ConstAlias.h"
+#include "DGtal/kernel/CInteger.h"
+#include "DGtal/kernel/PointVector.h"
+#include "DGtal/geometry/curves/FreemanChain.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class PackedFreemanChain
+  /**
+   * Description of template class 'PackedFreemanChain' <p>
+   * \brief Aim: Describes a digital 4-connected contour as a sequence
+   * of Freeman codes packed on 2 bits, together with the coordinates
+   * of its first point.
+   *
+   * This class stores the same information as FreemanChain, but uses
+   * 2 bits per code (32 codes per 64-bit word) instead of one
+   * character. A point is moreover stored every
+   * PackedFreemanChain::checkpointStep codes, so that the point at
+   * any position is retrieved in constant time: the displacement of
+   * each word between the checkpoint and the position is computed at
+   * once by counting the set bits of the word (see Bits::nbSetBits).
+   *
+   * Points are visited with a bidirectional ConstIterator which has
+   * the same semantic as FreemanChain::ConstIterator, so that the
+   * chain may be used with segment computers, segmentations or length
+   * estimators. Whole sequences of points are decoded with
+   * getPoints(), four codes at a time through a table.
+   *
+   * @code
+   std::fstream in( "contour.fc", std::ios::in );
+   PackedFreemanChain<int> pfc( in );  // no intermediate std::string
+   PackedFreemanChain<int>::Point p = pfc.getPoint( 123456 );
+   std::vector< PackedFreemanChain<int>::Point > pts;
+   pfc.getPoints( 0, pfc.size() + 1, std::back_inserter( pts ) );
+   * @endcode
+   *
+   * @tparam TInteger type of the coordinates of the points
+   *
+   * @see FreemanChain testPackedFreemanChain.cpp
+   */
+  template <typename TInteger>
+  class PackedFreemanChain
+  {
+  public:
+
+    BOOST_CONCEPT_ASSERT(( concepts::CInteger<TInteger> ) );
+    typedef TInteger Integer;
+    typedef PackedFreemanChain<Integer> Self;
+
+    typedef PointVector<2, Integer> Point;
+    typedef PointVector<2, Integer> Vector;
+
+    typedef unsigned int Size;
+    typedef unsigned int Index;
+
+    /// Type of the words storing the codes.
+    typedef DGtal::uint64_t Word;
+
+    /// Number of codes stored in one word.
+    static const unsigned int codesPerWord = 32;
+
+    /// Number of codes between two stored points (a multiple of codesPerWord).
+    static const unsigned int checkpointStep = 1024;
+
+    // ------------------------- iterator ------------------------------
+  public:
+
+    /**
+     * This class represents an iterator on the points of a packed
+     * Freeman chain, storing the current coordinates. Like
+     * FreemanChain::ConstIterator, it visits the size()+1 points of
+     * the chain, the past-the-end position being size()+1.
+     */
+    class ConstIterator
+    {
+    public:
+      typedef std::bidirectional_iterator_tag iterator_category;
+      typedef Point value_type;
+      typedef int difference_type;
+      typedef Point* pointer;
+      typedef Point reference;
+
+      /**
+       * Default Constructor.
+       * The object is not valid.
+       */
+      ConstIterator()
+        : myFc( NULL ), myPos( 0 )
+      { }
+
+      /**
+       * Constructor.
+       * Nb: complexity in O(1) (at most checkpointStep / codesPerWord words are read).
+       *
+       * @param aChain a packed Freeman chain,
+       * @param n the position in the chain (within 0 and aChain.size()+1).
+       */
+      ConstIterator( ConstAlias<PackedFreemanChain> aChain, Index n = 0 );
+
+      /**
+       * Constructor.
+       * It is the user's responsability to make sure that the data's are
+       * consistent. No verification is performed.
+       *
+       * @param aChain a packed Freeman chain,
+       * @param n the position in the chain.
+       * @param XY the point corresponding to the 'n'-th position of the chain.
+       */
+      ConstIterator( ConstAlias<PackedFreemanChain> aChain, Index n, const Point & XY )
+        : myFc( &aChain ), myPos( n ), myXY( XY )
+      { }
+
+      /**
+       * @return the current coordinates.
+       */
+      const Point& operator*() const
+      {
+        return myXY;
+      }
+
+      /**
+       * @return a pointer to the current coordinates.
+       */
+      const Point* operator->() const
+      {
+        return &myXY;
+      }
+
+      /**
+       * @return the current coordinates.
+       */
+      const Point& get() const
+      {
+        return myXY;
+      }
+
+      /**
+       * Pre-increment.
+       * Goes to the next point on the chain.
+       */
+      ConstIterator& operator++()
+      {
+        this->next();
+        return *this;
+      }
+
+      /**
+       * Post-increment.
+       * Goes to the next point on the chain.
+       */
+      ConstIterator operator++( int )
+      {
+        ConstIterator tmp( *this );
+        this->next();
+        return tmp;
+      }
+
+      /**
+       * Pre-decrement.
+       * Goes to the previous point on the chain.
+       */
+      ConstIterator& operator--()
+      {
+        this->previous();
+        return *this;
+      }
+
+      /**
+       * Post-decrement.
+       * Goes to the previous point on the chain.
+       */
+      ConstIterator operator--( int )
+      {
+        ConstIterator tmp( *this );
+        this->previous();
+        return tmp;
+      }
+
+      /**
+       * Goes to the next point on the chain.
+       */
+      void next();
+
+      /**
+       * Goes to the previous point on the chain if possible.
+       */
+      void previous();
+
+      /**
+       * @return the current position (as an index in the chain).
+       */
+      Index position() const
+      {
+        return myPos;
+      }
+
+      /**
+       * @return the associated packed Freeman chain.
+       */
+      const PackedFreemanChain * getChain() const
+      {
+        return myFc;
+      }
+
+      /**
+       * @return the current Freeman code (specifies the movement to the next
+       * point).
+       */
+      char getCode() const
+      {
+        ASSERT( myFc != 0 );
+        return myFc->code( myPos );
+      }
+
+      /**
+       * Equality operator.
+       * @param aOther the iterator to compare with (must be defined on
+       * the same chain).
+       * @return 'true' if their current positions coincide.
+       */
+      bool operator==( const ConstIterator & aOther ) const
+      {
+        ASSERT( myFc == aOther.myFc );
+        return myPos == aOther.myPos;
+      }
+
+      /**
+       * Inequality operator.
+       * @param aOther the iterator to compare with (must be defined on
+       * the same chain).
+       * @return 'true' if their current positions differs.
+       */
+      bool operator!=( const ConstIterator & aOther ) const
+      {
+        ASSERT( myFc == aOther.myFc );
+        return myPos != aOther.myPos;
+      }
+
+      /**
+       * Inferior operator.
+       * @param aOther the iterator to compare with (must be defined on
+       * the same chain).
+       * @return 'true' if the current position of 'this' is before
+       * the current position of [aOther].
+       */
+      bool operator<( const ConstIterator & aOther ) const
+      {
+        ASSERT( myFc == aOther.myFc );
+        return myPos < aOther.myPos;
+      }
+
+    private:
+      /// The chain visited by the iterator.
+      const PackedFreemanChain* myFc;
+      /// The current position in the chain.
+      Index myPos;
+      /// The current coordinates of the iterator.
+      Point myXY;
+    };
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+     * Constructor.
+     * @param x the x-coordinate of the first point.
+     * @param y the y-coordinate of the first point.
+     */
+    PackedFreemanChain( Integer x = 0, Integer y = 0 );
+
+    /**
+     * Constructor from a Freeman chain.
+     * @param fc any Freeman chain.
+     */
+    PackedFreemanChain( const FreemanChain<Integer> & fc );
+
+    /**
+     * Constructor.
+     * @param in any input stream in the Freeman chain file format (see read()).
+     */
+    PackedFreemanChain( std::istream & in );
+
+    /**
+     * Comparison operator.
+     * @param other the object to compare to.
+     * @return 'true' both chains have the same first point and the same codes.
+     */
+    bool operator==( const PackedFreemanChain & other ) const;
+
+    /**
+     * Comparison operator.
+     * @param other the object to compare to.
+     * @return 'true' both chains are different, 'false' otherwise.
+     */
+    bool operator!=( const PackedFreemanChain & other ) const
+    {
+      return !( (*this) == other );
+    }
+
+    /**
+     * Removes all the codes and sets the first point.
+     * @param x the x-coordinate of the first point.
+     * @param y the y-coordinate of the first point.
+     */
+    void clear( Integer x = 0, Integer y = 0 );
+
+    /**
+     * Allocates memory for at least @a n codes.
+     * @param n a number of codes.
+     */
+    void reserve( Size n );
+
+    /**
+     * Adds one code at the end of the chain.
+     * @param aCode a Freeman code ('0', '1', '2' or '3').
+     * @return reference to this.
+     */
+    PackedFreemanChain & extend( char aCode );
+
+    /**
+     * @param pos a position in the chain code.
+     * @return the code at position [pos], as a character '0', '1', '2' or '3'.
+     *
+     * Note, it is assumed that 0 <= pos < this->size()
+     */
+    char code( Index pos ) const;
+
+    /**
+     * @return the number of codes of the chain.
+     */
+    Size size() const
+    {
+      return mySize;
+    }
+
+    /**
+     * @return the starting point of the chain.
+     */
+    Point firstPoint() const
+    {
+      return myFirst;
+    }
+
+    /**
+     * @return the last point of the chain.
+     */
+    Point lastPoint() const
+    {
+      return myLast;
+    }
+
+    /**
+     * @return 'true' if the chain ends at the same point it starts.
+     */
+    bool isClosed() const
+    {
+      return myFirst == myLast;
+    }
+
+    /**
+     * Computes the point where starts the step at position 'pos' of the
+     * chain. If 'pos' is equal to the length of the chain then the
+     * last point is returned.
+     *
+     * Nb: complexity in O(1), at most checkpointStep / codesPerWord
+     * words are read.
+     *
+     * @param pos the position of the point in the chain.
+     * @return the point at position 'pos'.
+     */
+    Point getPoint( Index pos ) const;
+
+    /**
+     * Decodes the points at positions [pos, pos+n) of the chain.
+     *
+     * @param pos the position of the first point.
+     * @param n the number of points, such that pos+n <= size()+1.
+     * @param out the output iterator where the points are written.
+     * @return the output iterator after the writing.
+     * @tparam OutputIterator any model of output iterator on Point.
+     */
+    template <typename OutputIterator>
+    OutputIterator getPoints( Index pos, Size n, OutputIterator out ) const;
+
+    /**
+     * @return the Freeman chain coding the same contour.
+     */
+    FreemanChain<Integer> unpack() const;
+
+    /**
+     * @return the number of bytes used to store the codes and the
+     * checkpoints.
+     */
+    std::size_t memoryFootprint() const;
+
+    // ----------------------- Iteration services ------------------------------
+  public:
+
+    /**
+     * Iterator service on points.
+     * @return an iterator pointing on the first point of the chain.
+     */
+    ConstIterator begin() const;
+
+    /**
+     * Iterator service on points.
+     * @return an iterator pointing after the last point of the chain.
+     */
+    ConstIterator end() const;
+
+    // ------------------------- Static services -----------------------
+  public:
+
+    /**
+     * Outputs the chain [c] to the stream [out], in the Freeman chain
+     * file format.
+     * @param out any output stream,
+     * @param c a packed Freeman chain.
+     */
+    static void write( std::ostream & out, const PackedFreemanChain & c );
+
+    /**
+     * Reads a chain from the stream [in] and updates [c]. The codes are
+     * read one character at a time and packed on the fly: the
+     * chain is never stored as a string.
+     *
+     * The format is the one of FreemanChain::read: lines starting
+     * with '#' are ignored, then the coordinates of the first point are
+     * followed by the codes.
+     *
+     * @param in any input stream,
+     * @param c (returns) the packed Freeman chain.
+     */
+    static void read( std::istream & in, PackedFreemanChain & c );
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+
+    /// The codes, packed on 2 bits, the first code in the lowest bits.
+    std::vector<Word> myCodes;
+
+    /// The points at positions 0, checkpointStep, 2*checkpointStep, ...
+    std::vector<Point> myCheckpoints;
+
+    /// The number of codes.
+    Size mySize;
+
+    /// The first point.
+    Point myFirst;
+
+    /// The last point.
+    Point myLast;
+
+    // ------------------------- Internals ------------------------------------
+  private:
+
+    /**
+     * Computes the displacement coded by the first codes of a word.
+     * @param w a word.
+     * @param n the number of codes to consider (at most codesPerWord).
+     * @return the displacement.
+     */
+    static Vector wordDisplacement( Word w, unsigned int n );
+
+    /**
+     * @param aCode a code within 0 and 3.
+     * @return the displacement coded by aCode.
+     */
+    static Vector displacement( unsigned int aCode );
+
+  }; // end of class PackedFreemanChain
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'PackedFreemanChain'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'PackedFreemanChain' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TInteger>
+  std::ostream&
+  operator<< ( std::ostream & out, const PackedFreemanChain<TInteger> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/geometry/curves/PackedFreemanChain.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined PackedFreemanChain_h
+
+#undef PackedFreemanChain_RECURSES
+#endif // else defined(PackedFreemanChain_RECURSES)
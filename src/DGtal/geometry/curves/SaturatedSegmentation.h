@@ -41,6 +41,7 @@
 //////////////////////////////////////////////////////////////////////////////
 // Inclusions
 #include <iostream>
+#include <vector>
 #include "DGtal/base/Common.h"
 
 #include "DGtal/geometry/curves/SegmentComputerUtils.h"
@@ -146,6 +147,17 @@ namespace DGtal
   theSegmentation.setMode("First");
    * @endcode  
    * 
+   * The whole set of maximal segments may also be retrieved at once with
+   * the maximalSegments() method. For ranges given by iterators (not
+   * circulators), the range is then split into chunks that are processed
+   * independently (in parallel if DGtal has been built with OpenMP
+   * support, WITH_OPENMP flag set to "true"), and the partial results
+   * are stitched at the chunk boundaries. The retrieved segments are
+   * exactly the ones visited by SegmentComputerIterator, in the same order.
+   * @code
+  std::vector<SegmentComputer> segments = theSegmentation.maximalSegments( 8 );
+   * @endcode
+   *
    * @see testSegmentation.cpp
    */
 
@@ -451,6 +463,26 @@ namespace DGtal
      */
     typename SaturatedSegmentation::SegmentComputerIterator end() const;
 
+    /**
+     * Computes all the maximal segments of the segmentation at once.
+     *
+     * For ranges given by iterators, the part of the range containing
+     * the first element of the maximal segments is split into @a nbChunks
+     * chunks. In each chunk, the first maximal segment starting in
+     * the chunk is computed, then the next maximal segments are computed
+     * until the first maximal segment of the next chunk is reached.
+     * Chunks are processed in parallel if DGtal has been built with
+     * OpenMP support. Circulators are processed sequentially.
+     *
+     * Nb: the same segments as the ones visited by SegmentComputerIterator
+     * are returned, in the same order.
+     *
+     * @param nbChunks the number of chunks (0 means one chunk per
+     * OpenMP thread, or a single chunk without OpenMP).
+     * @return the maximal segments of the segmentation.
+     */
+    std::vector<SegmentComputer> maximalSegments( unsigned int nbChunks = 0 ) const;
+
 
     /**
      * Writes/Displays the object on an output stream.
@@ -520,6 +552,37 @@ namespace DGtal
     // ------------------------- Internals ------------------------------------
   private:
 
+    /**
+     * Computes all the maximal segments of the segmentation by
+     * incrementing a SegmentComputerIterator.
+     * @param segments (returned) the maximal segments.
+     */
+    void sequentialMaximalSegments( std::vector<SegmentComputer>& segments ) const;
+
+    /**
+     * maximalSegments() for ranges given by iterators.
+     * @param nbChunks the number of chunks.
+     * @return the maximal segments of the segmentation.
+     */
+    std::vector<SegmentComputer> maximalSegments( unsigned int nbChunks, IteratorType ) const;
+
+    /**
+     * maximalSegments() for ranges given by circulators.
+     * @param nbChunks the number of chunks (not used).
+     * @return the maximal segments of the segmentation.
+     */
+    std::vector<SegmentComputer> maximalSegments( unsigned int nbChunks, CirculatorType ) const;
+
+    /**
+     * Computes the first maximal segment whose first element
+     * is @a it or any element located after @a it.
+     * @param s (returned) any instance of segment computer.
+     * @param it any iterator of the underlying range such that
+     * at least one maximal segment begins at or after @a it.
+     */
+    void firstMaximalSegmentFrom( SegmentComputer& s,
+                                  const ConstIterator& it ) const;
+
   }; // end of class SaturatedSegmentation
 
 
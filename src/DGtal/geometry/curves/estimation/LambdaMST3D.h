@@ -40,7 +40,7 @@
 #include <iterator>
 #include <cmath>
 #include <vector>
-#include <map>
+#include <utility>
 #include <DGtal/base/Common.h>
 #include <DGtal/helpers/StdDefs.h>
 #include "DGtal/kernel/CSpace.h"
@@ -121,6 +121,19 @@ namespace DGtal {
      * @tparam OutputIterator writable iterator.
      * More efficient way to compute tangent directions for all points of a curve.
      *
+     * Each point of [itb, ite) is given its index in the range and the
+     * contributions of the DSSs are stored in contiguous arrays, the
+     * contributions to a point being consecutive and ordered as the DSSs of
+     * the segmentation. If DGtal has been built with OpenMP support
+     * (WITH_OPENMP flag set to "true"), the contributions are computed in
+     * parallel over chunks of the range.
+     *
+     * Since the points are identified by their index, a curve which visits a
+     * point several times (self-intersecting or back-tracking curve) gets one
+     * tangent per visit, estimated from the DSSs covering this visit only.
+     * Before, the contributions of all the visits were summed up into the
+     * first one and the next visits got a null vector.
+     *
      * @param itb begin iterator
      * @param ite end iterator
      * @param result writable iterator over a container which stores estimated tangent directions.
@@ -138,7 +151,7 @@ namespace DGtal {
   protected:
 
       typedef typename std::vector<SegmentComputer >::const_iterator OrphanDSSIterator;
-    
+
     /**
      * @brief Accumulate partial results obtained for each point.
      * In 3D it can happen that DSSs' direction vectors over same point are opposite.
@@ -147,13 +160,14 @@ namespace DGtal {
      * Finally, tangent direction is estimated and stored.
      * 
      * @tparam OutputIterator writable iterator.
-     * @param outValues partial results for each point
-     * @param itb begin iterator
-     * @param ite end iterator
+     * @param offsets the partial results of the i-th point are values[offsets[i]],
+     * ..., values[offsets[i+1]-1]
+     * @param values partial results of all the points
      * @param result writable iterator over a container which stores estimated tangent directions.
      */
     template <typename OutputIterator>
-    void accumulate ( std::multimap < Point, Value > & outValues, ConstIterator itb, ConstIterator ite, OutputIterator & result );
+    void accumulate ( const std::vector < std::size_t > & offsets, const std::vector < Value > & values,
+                      OutputIterator & result );
 
     /**
      * @brief Use the DSS filter defined conditions to ensure estimation over not covered points - orphans.
@@ -164,10 +178,22 @@ namespace DGtal {
      * @return estimated tangent
      */
     Value treatOrphan(OrphanDSSIterator begin, OrphanDSSIterator end, const Point &p);
-    template < typename DSSesIterator, typename OrphanIterator >
 
-    void treatOrphans(DSSesIterator begin, DSSesIterator end, OrphanIterator obegin, OrphanIterator oend,
-                       std::multimap<Point, Value> &outValues);
+    /**
+     * @brief Computes the partial results of the points that are not covered by any DSS
+     * passing through the filter - orphans.
+     *
+     * @param begin begin iterator on the DSSs
+     * @param end end iterator on the DSSs
+     * @param itb begin iterator of the range of points
+     * @param isOrphan flags of the points of the range that are orphans
+     * @param outValues (returned) pairs made of the index of an orphan in the
+     * range and of a partial result, sorted by index
+     */
+    template < typename DSSesIterator >
+    void treatOrphans ( DSSesIterator begin, DSSesIterator end, ConstIterator itb,
+                        const std::vector < char > & isOrphan,
+                        std::vector < std::pair < std::size_t, Value > > & outValues );
 
 
     // ------------------------- Private Datas --------------------------------
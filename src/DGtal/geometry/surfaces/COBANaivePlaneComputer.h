@@ -94,7 +94,9 @@ namespace DGtal
    * Note on execution times: The user should favor int64_t instead of
    * BigInteger whenever possible (diameter smaller than 500). The
    * speed-up is between 10 and 20 for these diameters. For greater
-   * diameters, it is necessary to use BigInteger (see below).
+   * diameters, DGtal::int128_t (when WITH_INT128 is defined) avoids
+   * the allocations of BigInteger up to diameters of approximately
+   * 500000, it is necessary to use BigInteger beyond (see below).
    *
    * @tparam TSpace specifies the type of digital space in which lies
    * input digital points. A model of CSpace.
@@ -103,7 +105,8 @@ namespace DGtal
    * internal computations. The type should be able to hold integers
    * of order (2*D^3)^2 if D is the diameter of the set of digital
    * points. In practice, diameter is limited to 20 for int32_t,
-   * diameter is approximately 500 for int64_t, and whatever with
+   * diameter is approximately 500 for int64_t, approximately 500000
+   * for int128_t, and whatever with
    * BigInteger/GMP integers. For huge diameters, the slow-down is
    * polylogarithmic with respect to the diameter.
    *
@@ -89,8 +89,8 @@ namespace DGtal
    *  int64_t instead of BigInteger whenever possible. When the point
    *  components are smaller than 14000, int32_t are sufficient. For
    *  point components smaller than 440000000, int64_t are
-   *  sufficient. For greater diameters, it is necessary to use
-   *  BigInteger.
+   *  sufficient. For greater diameters, DGtal::int128_t (when
+   *  WITH_INT128 is defined) is much faster than BigInteger.
 
    * \par What is the best algorithm to check if a set of digital points is some (naive) plane ?
 
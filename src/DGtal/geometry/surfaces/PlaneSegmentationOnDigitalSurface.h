@@ -0,0 +1,335 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file PlaneSegmentationOnDigitalSurface.h
+ *
+ * @author DGtal development team (\c dgtal-devel@lists.gforge.liris.cnrs.fr )
+ *
+ * @date 2026/10/19
+ *
+ * Header file for module PlaneSegmentationOnDigitalSurface.cpp
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(PlaneSegmentationOnDigitalSurface_RECURSES)
+#error Recursive header files inclusion detected in PlaneSegmentationOnDigitalSurface.h
+#else // defined(PlaneSegmentationOnDigitalSurface_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define PlaneSegmentationOnDigitalSurface_RECURSES
+
+#if !defined PlaneSegmentationOnDigitalSurface_h
+/** Prevents repeated inclusion of headers. */
+#define PlaneSegmentationOnDigitalSurface_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <vector>
+#include <atomic>
+#include <unordered_set>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/ConstAlias.h"
+#include "DGtal/base/CountedConstPtrOrConstPtr.h"
+#include "DGtal/geometry/surfaces/ChordGenericNaivePlaneComputer.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class PlaneSegmentationOnDigitalSurface
+  /**
+   * Description of template class 'PlaneSegmentationOnDigitalSurface' <p>
+   * \brief Aim: Segments a whole 3D digital surface into maximal
+   * pieces of digital planes, and gives for each surfel the label of
+   * its plane and the normal vector of this plane.
+   *
+   * The segmentation is greedy, as in the example \ref
+   * greedy-plane-segmentation-ex2.cpp :
+   * -# patches are grown from seed surfels by a breadth-first
+   *    traversal of the surface, each surfel being added to the
+   *    plane computer with its inner voxel, and expanded only if
+   *    the extension succeeds. The score of a surfel is the size of
+   *    the largest patch containing it.
+   * -# surfels are then processed by decreasing score: a patch is
+   *    grown from the seed of the patch giving the score of each
+   *    surfel that is not yet labelled (or from the surfel itself
+   *    if this seed is labelled), among the surfels that are not
+   *    yet labelled, and all its surfels get a new label. If the
+   *    labelled surfels cut this patch from the surfel, a second
+   *    patch is grown from the surfel itself.
+   *
+   * Growing a patch from every surfel, as the example does, means
+   * running as many plane recognitions as surfels, on heavily
+   * overlapping patches. By default, the recognitions are shared
+   * between these patches: the surfels are cut in chunks of
+   * consecutive indices, and a surfel of a chunk is not used as a
+   * seed if it already belongs to a patch grown from a previous seed
+   * of its chunk; its score is given by the patches containing
+   * it. Hence the number of recognitions is about the number of
+   * surfels divided by the mean size of a patch. The exhaustive
+   * strategy of the example (one patch per surfel, whose size is the
+   * score of the surfel) is still available.
+   *
+   * All the data that the recognitions have in common is computed
+   * once at construction: the surfels are indexed, their inner
+   * voxels are stored, and the adjacency of the surface is stored in
+   * flat arrays of indices, so that the traversals never query the
+   * digital surface container (whose tracker-based neighborhood
+   * computations dominate the cost of a traversal through the
+   * BreadthFirstVisitor). The visited surfels of a traversal are
+   * stored in a hash set, so that the memory of a thread is
+   * proportional to the size of a patch. The chunks of the first
+   * pass are independent and are processed in parallel when OpenMP
+   * is enabled, each thread using its own copy of the plane
+   * computer, and the best patch of each surfel being updated
+   * atomically (hence the surface has less than 2^32 surfels). Chunks do not depend on the number of threads,
+   * so neither does the segmentation.
+   *
+   * The plane computer is given as an initialized prototype (model
+   * of CAdditivePrimitiveComputer, with methods \c clear, \c size
+   * and \c getUnitNormal), typically a ChordGenericNaivePlaneComputer
+   * or a COBAGenericNaivePlaneComputer, since the main axis of a
+   * patch is not known in advance. The internal integer type of the
+   * computer should be chosen according to the coordinates of the
+   * surface: with ChordGenericNaivePlaneComputer, \c DGtal::int64_t
+   * are sufficient for coordinates below \f$ 4.4 \times 10^8 \f$,
+   * and \c DGtal::int128_t (the default when WITH_INT128 is defined)
+   * for any 32-bit coordinates.
+   *
+   * @code
+   typedef PlaneSegmentationOnDigitalSurface< MyDigitalSurface > Segmentation;
+   Segmentation::PlaneComputer prototype;
+   prototype.init( 1, 1 ); // naive planes
+   Segmentation segmentation( digSurf );
+   segmentation.compute( prototype );
+   for ( Segmentation::Index i = 0; i < segmentation.size(); ++i )
+     std::cout << segmentation.surfels()[ i ] << " "
+               << segmentation.label( i ) << " "
+               << segmentation.normal( i ) << std::endl;
+   * @endcode
+   *
+   * @tparam TDigitalSurface the type of digital surface (e.g. any
+   * DigitalSurface in 3D).
+   *
+   * @tparam TPlaneComputer the type of plane computer, default to
+   * ChordGenericNaivePlaneComputer with \c DGtal::int128_t (\c
+   * DGtal::int64_t when 128-bit integers are not available).
+   */
+  template < typename TDigitalSurface,
+             typename TPlaneComputer =
+             ChordGenericNaivePlaneComputer< typename TDigitalSurface::KSpace::Space,
+                                             typename TDigitalSurface::KSpace::Point,
+#ifdef WITH_INT128
+                                             DGtal::int128_t
+#else
+                                             DGtal::int64_t
+#endif
+                                             > >
+  class PlaneSegmentationOnDigitalSurface
+  {
+    // ----------------------- public types ------------------------------
+  public:
+    typedef TDigitalSurface DigitalSurface;
+    typedef TPlaneComputer PlaneComputer;
+    typedef typename DigitalSurface::KSpace KSpace;
+    typedef typename DigitalSurface::Surfel Surfel;
+    typedef typename KSpace::Space Space;
+    typedef typename KSpace::Point Point;
+    typedef typename Space::RealVector RealVector;
+    typedef std::size_t Index;
+    typedef std::size_t Label;
+    typedef std::size_t Size;
+    BOOST_STATIC_ASSERT(( KSpace::dimension == 3 ));
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+     * Constructor. Indexes the surfels of the surface and computes
+     * their inner voxels and their adjacency.
+     * @param aSurface the digital surface (aliased).
+     */
+    PlaneSegmentationOnDigitalSurface( ConstAlias<DigitalSurface> aSurface );
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Segments the surface into maximal pieces of planes.
+     * @param aPrototype an initialized plane computer, copied for
+     * each recognition.
+     * @param aSharePatches when 'true' (default), the surfels that
+     * belong to a patch already grown in their chunk are not used as
+     * seeds in the first pass; when 'false', a patch is grown from
+     * every surfel.
+     */
+    void compute( const PlaneComputer & aPrototype, bool aSharePatches = true );
+
+    /// @return the digital surface.
+    CountedConstPtrOrConstPtr<DigitalSurface> surface() const;
+
+    /// @return the number of surfels.
+    Size size() const;
+
+    /// @return the surfels, in the order of their indices.
+    const std::vector<Surfel> & surfels() const;
+
+    /**
+     * @param aSurfel any surfel of the surface.
+     * @return its index.
+     */
+    Index index( const Surfel & aSurfel ) const;
+
+    /// @return the number of planes of the last segmentation.
+    Size nbPlanes() const;
+
+    /**
+     * @param i any surfel index.
+     * @return the label of its plane, in [0,nbPlanes()[.
+     * @pre compute() has been called.
+     */
+    Label label( Index i ) const;
+
+    /// @return the label of each surfel, in the order of their indices.
+    const std::vector<Label> & labels() const;
+
+    /**
+     * @param i any surfel index.
+     * @return the unit normal vector of the plane of this surfel,
+     * oriented outward, ie. as the trivial normal of the surfel.
+     * @pre compute() has been called.
+     */
+    RealVector normal( Index i ) const;
+
+    /// @return the oriented normal of each surfel, in the order of
+    /// their indices.
+    std::vector<RealVector> normals() const;
+
+    /**
+     * @param l any plane label.
+     * @return the unit normal vector of this plane (not oriented).
+     */
+    const RealVector & planeNormal( Label l ) const;
+
+    /**
+     * @param l any plane label.
+     * @return the number of surfels of this plane.
+     */
+    Size planeSize( Label l ) const;
+
+    /**
+     * @param i any surfel index.
+     * @return the size of the largest patch containing this surfel
+     * in the first pass of the segmentation (the patch grown from
+     * this surfel if patches are not shared), ie. the number of
+     * distinct inner voxels of its surfels.
+     */
+    Size score( Index i ) const;
+
+    /**
+     * @param i any surfel index.
+     * @return the seed of the patch giving the score of this surfel.
+     */
+    Index scoreSeed( Index i ) const;
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+
+    /// The digital surface.
+    CountedConstPtrOrConstPtr<DigitalSurface> mySurface;
+    /// The surfels, sorted.
+    std::vector<Surfel> mySurfels;
+    /// The inner voxel of each surfel.
+    std::vector<Point> myPoints;
+    /// The indices of the neighbors of all surfels.
+    std::vector<Index> myNeighbors;
+    /// The offset of the neighbors of each surfel in myNeighbors
+    /// (size() + 1 offsets).
+    std::vector<Index> myNeighborOffsets;
+    /// The score of each surfel.
+    std::vector<Size> myScores;
+    /// The seed of the patch giving the score of each surfel.
+    std::vector<Index> myScoreSeeds;
+    /// The label of each surfel.
+    std::vector<Label> myLabels;
+    /// The normal of each plane.
+    std::vector<RealVector> myPlaneNormals;
+    /// The size of each plane.
+    std::vector<Size> myPlaneSizes;
+
+    // ------------------------- Internals ------------------------------------
+  private:
+
+    /**
+     * Grows a patch from a surfel by a breadth-first traversal.
+     * @param aSeed the index of the first surfel.
+     * @param aComputer (modified) a cleared plane computer, which
+     * contains the patch afterwards.
+     * @param aQueue (modified) a buffer for the traversal, which
+     * contains the visited surfels afterwards.
+     * @param aVisited (modified) the surfels visited by this traversal.
+     * @param aPatch (returns) the surfels of the patch.
+     * @param aFree if 'true', only the surfels without label are visited.
+     */
+    void grow( Index aSeed, PlaneComputer & aComputer,
+               std::vector<Index> & aQueue, std::unordered_set<Index> & aVisited,
+               std::vector<Index> & aPatch, bool aFree ) const;
+
+  }; // end of class PlaneSegmentationOnDigitalSurface
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'PlaneSegmentationOnDigitalSurface'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'PlaneSegmentationOnDigitalSurface' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TDigitalSurface, typename TPlaneComputer>
+  std::ostream&
+  operator<< ( std::ostream & out,
+               const PlaneSegmentationOnDigitalSurface<TDigitalSurface, TPlaneComputer> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/geometry/surfaces/PlaneSegmentationOnDigitalSurface.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined PlaneSegmentationOnDigitalSurface_h
+
+#undef PlaneSegmentationOnDigitalSurface_RECURSES
+#endif // else defined(PlaneSegmentationOnDigitalSurface_RECURSES)
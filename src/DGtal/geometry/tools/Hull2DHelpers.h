@@ -357,6 +357,159 @@ namespace DGtal
 				   OutputIterator res, 
 				   const Predicate& aPredicate ); 
 
+    /**
+     * @brief Exact orientation test of three points with integer
+     * coordinates, i.e. the sign of the determinant of the vectors
+     * @a b - @a a and @a c - @a a.
+     *
+     * When all the coordinate differences are lower than \f$ 2^{31}
+     * \f$ (e.g. for 32-bit coordinates in a range of \f$ 2^{31} \f$),
+     * the determinant is computed with 64-bit integers. Otherwise, a
+     * floating-point filter is tried first, and the sign is finally
+     * computed by AvnaimEtAl2x2DetSignComputer on 64-bit integers.
+     * The result is thus exact for 32-bit coordinates and for 64-bit
+     * coordinates whose differences fit in 64-bit integers.
+     *
+     * @param a first point
+     * @param b second point
+     * @param c third point
+     * @return 1 if (@a a, @a b, @a c) is counter-clockwise oriented,
+     * -1 if it is clockwise oriented, 0 if the points are collinear.
+     *
+     * @tparam TPoint a model of 2D point with integer coordinates.
+     */
+    template <typename TPoint>
+    int orientation(const TPoint& a, const TPoint& b, const TPoint& c);
+
+    /**
+     * @brief Exact orientation tests of all the points of the range
+     * [ @a itb , @a ite ) with respect to the line (@a a, @a b), as
+     * computed by Hull2D::orientation. The coordinates are first
+     * copied to contiguous arrays, so that the determinants are
+     * computed by a loop that the compiler vectorizes when the
+     * coordinate differences are lower than \f$ 2^{31} \f$.
+     *
+     * @param a first point of the line
+     * @param b second point of the line
+     * @param itb begin iterator
+     * @param ite end iterator
+     * @param res output iterator receiving one orientation (-1, 0 or
+     * 1) per point of the range.
+     *
+     * @tparam TPoint a model of 2D point with integer coordinates.
+     * @tparam ForwardIterator a model of forward and readable iterator
+     * @tparam OutputIterator a model of incrementable and writable iterator of int.
+     */
+    template <typename TPoint,
+              typename ForwardIterator,
+              typename OutputIterator>
+    void orientations(const TPoint& a, const TPoint& b,
+                      const ForwardIterator& itb,
+                      const ForwardIterator& ite,
+                      OutputIterator res);
+
+    /**
+     * @brief Ternary predicate returning 'true' for counter-clockwise
+     * oriented points (and for collinear points if @a acceptZero is
+     * 'true'), computed with the exact Hull2D::orientation. It has no
+     * state, hence it can be used concurrently by several threads.
+     *
+     * @tparam acceptZero 'true' to accept collinear points.
+     */
+    template <bool acceptZero = false>
+    struct OrientationPredicate
+    {
+      /**
+       * @param a first point
+       * @param b second point
+       * @param c third point
+       * @return 'true' iff (@a a, @a b, @a c) is counter-clockwise
+       * oriented (or collinear if @a acceptZero is 'true').
+       * @tparam TPoint a model of 2D point with integer coordinates.
+       */
+      template <typename TPoint>
+      bool operator()(const TPoint& a, const TPoint& b, const TPoint& c) const
+      {
+        const int o = orientation( a, b, c );
+        return acceptZero ? ( o >= 0 ) : ( o > 0 );
+      }
+    };
+
+    /**
+     * @brief Removes from @a aPoints the points lying strictly inside
+     * the quadrilateral formed by the leftmost, lowest, rightmost and
+     * uppermost points [Akl and Toussaint, 1978]. They cannot be
+     * vertices of the convex hull, nor lie on its boundary, hence the
+     * convex hull is unchanged for any predicate. The orientation
+     * tests are done by batches (see Hull2D::orientations). The order
+     * of the remaining points is kept.
+     *
+     * @param aPoints a vector of 2D points with integer coordinates.
+     *
+     * @tparam TPoint a model of 2D point with integer coordinates.
+     */
+    template <typename TPoint>
+    void aklToussaintFilter(std::vector<TPoint>& aPoints);
+
+    /**
+     * @brief Parallel version of Hull2D::andrewConvexHullAlgorithm
+     * for large point sets, returning the same vertices in the same
+     * order. Points are first filtered by Hull2D::aklToussaintFilter,
+     * then the remaining points are split into chunks whose hulls
+     * are computed in parallel (OpenMP). The hull of the union of
+     * their vertices is finally computed by
+     * Hull2D::andrewConvexHullAlgorithm.
+     *
+     * @warning The predicate is called concurrently by several
+     * threads. Unlike PredicateFromOrientationFunctor2, which shares
+     * its orientation functor, Hull2D::OrientationPredicate can be
+     * used.
+     *
+     * @param itb begin iterator
+     * @param ite end iterator
+     * @param res output iterator used to export the retrieved points
+     * @param aPredicate any thread-safe ternary predicate
+     *
+     * @tparam ForwardIterator a model of forward and readable iterator
+     * on points with integer coordinates
+     * @tparam OutputIterator a model of incrementable and writable iterator
+     * @tparam Predicate a model of ternary predicate
+     */
+    template <typename ForwardIterator,
+              typename OutputIterator,
+              typename Predicate >
+    void parallelAndrewConvexHullAlgorithm(const ForwardIterator& itb,
+                                           const ForwardIterator& ite,
+                                           OutputIterator res,
+                                           const Predicate& aPredicate );
+
+    /**
+     * @brief Computes with Hull2D::andrewConvexHullAlgorithm the
+     * convex hulls of many point sets, in parallel (OpenMP). Each
+     * thread reuses its own buffers from one set to the next, so that
+     * small sets are processed without memory allocation.
+     *
+     * @warning The predicate is called concurrently by several
+     * threads (see Hull2D::parallelAndrewConvexHullAlgorithm).
+     *
+     * @param itb begin iterator on the point sets
+     * @param ite end iterator on the point sets
+     * @param[out] res the vertices of each convex hull, in the order of the sets.
+     * @param aPredicate any thread-safe ternary predicate
+     *
+     * @tparam RandomAccessIterator a model of random access iterator
+     * on containers (or ranges) of points
+     * @tparam TPoint the type of point
+     * @tparam Predicate a model of ternary predicate
+     */
+    template <typename RandomAccessIterator,
+              typename TPoint,
+              typename Predicate >
+    void batchAndrewConvexHullAlgorithm(const RandomAccessIterator& itb,
+                                        const RandomAccessIterator& ite,
+                                        std::vector< std::vector<TPoint> >& res,
+                                        const Predicate& aPredicate );
+
 
     /**
      *  @brief Procedure to compute the convex hull thickness given
@@ -434,6 +587,25 @@ namespace DGtal
                                 TInputPoint& antipodalEdgeQ,
                                 TInputPoint& antipodalVertexR);
 
+    /**
+     * @brief Computes with Hull2D::computeHullThickness the thickness
+     * of many convex hulls, in parallel (OpenMP).
+     *
+     * @param[in] itb begin iterator on the convex hulls.
+     * @param[in] ite end iterator on the convex hulls.
+     * @param[in] def definition of the thickness used in the estimation (i.e HorizontalVerticalThickness or EuclideanThickness)
+     * @param[out] res the thickness of each convex hull, in the order of the hulls.
+     *
+     * @tparam RandomAccessIterator a model of random access iterator
+     * on containers of points, each one being the counter clockwise
+     * oriented vertices of a convex hull.
+     **/
+    template <typename RandomAccessIterator>
+    void batchComputeHullThickness(const RandomAccessIterator& itb,
+                                   const RandomAccessIterator& ite,
+                                   const ThicknessDefinition& def,
+                                   std::vector<double>& res);
+
 
     /**
      * Computes the angle between the line (@a a,@a b) and (@a c,@a d)
@@ -0,0 +1,295 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file InBallByFilteredDet.h
+ *
+ * @author DGtal development team (\c dgtal-devel@lists.gforge.liris.cnrs.fr )
+ *
+ * @date 2026/10/19
+ *
+ * Header file for module InBallByFilteredDet.cpp
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(InBallByFilteredDet_RECURSES)
+#error Recursive header files inclusion detected in InBallByFilteredDet.h
+#else // defined(InBallByFilteredDet_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define InBallByFilteredDet_RECURSES
+
+#if !defined InBallByFilteredDet_h
+/** Prevents repeated inclusion of headers. */
+#define InBallByFilteredDet_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <array>
+#include "DGtal/base/Common.h"
+
+#include "DGtal/kernel/NumberTraits.h"
+#include "DGtal/kernel/CEuclideanRing.h"
+#include "DGtal/geometry/tools/determinant/InHalfSpaceByFilteredDet.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class InBallByFilteredDet
+  /**
+   * \brief Aim: Class that implements an exact in-circle (dimension
+   * 2) or in-sphere (dimension 3) test, ie. it provides a way to
+   * determine the position of a given point with respect to the
+   * circle passing by three given points, or to the sphere passing
+   * by four given points.
+   * More precisely, it returns:
+   * - zero if the point belongs to the circle (resp. sphere)
+   * - strictly negative if the point lies in its interior
+   * - strictly positive if the point lies in its exterior.
+   *
+   * The given points must not be collinear (resp. coplanar). Their
+   * orientation is computed once at initialization by
+   * InHalfSpaceByFilteredDet.
+   *
+   * The test is the sign of the determinant of the difference vectors
+   * from the first given point, lifted on the paraboloid
+   * \f$ z = x^2 + y^2 \f$ (resp. \f$ t = x^2 + y^2 + z^2 \f$). This
+   * determinant is expanded along the row of the tested point, so
+   * that its cofactors are computed once for all at
+   * initialization. Like in InHalfSpaceByFilteredDet, it is first
+   * evaluated with doubles, and computed exactly with integers of
+   * type TInteger only if the floating-point error bound does not
+   * allow to conclude. The error bound is either dynamic or static,
+   * if a bound on the absolute value of the coordinates is given at
+   * construction.
+   *
+   * Basic usage:
+   @code
+   ...
+   typedef Z2i::Point Point;
+   typedef InBallByFilteredDet<Point, DGtal::int64_t> MyType;
+
+   MyType inCircleTest;
+   inCircleTest.init( Point(5,0), Point(0,5), Point(-5,0) );
+   return inCircleTest( Point(-4,1) );
+   //a strictly negative value is returned because (-4,1) lies in the
+   //interior of the circle of center (0,0) and radius 5.
+   @endcode
+   *
+   * This class is a model of COrientationFunctor.
+   *
+   * @tparam TPoint a model of point of dimension 2 or 3
+   * @tparam TInteger a model of integer used when the filter fails,
+   * at least a model of CEuclideanRing. If the point coordinates are
+   * coded with b bits, TInteger must represent integers with 4b+8
+   * bits in dimension 2 and 5b+12 bits in dimension 3 (e.g.
+   * DGtal::int64_t for 2d points with coordinates in
+   * \f$ ]-2^{13};2^{13}[ \f$, DGtal::BigInteger in general).
+   *
+   * @see InHalfSpaceByFilteredDet InGeneralizedDiskOfGivenRadius
+   */
+  template <typename TPoint, typename TInteger>
+  class InBallByFilteredDet
+  {
+    // ----------------------- Types  ------------------------------------
+  public:
+
+    /**
+     * Type of points
+     */
+    typedef TPoint Point;
+    BOOST_STATIC_ASSERT(( ( Point::dimension == 2 ) || ( Point::dimension == 3 ) ));
+
+    /**
+     * Type of point array
+     */
+    typedef std::array<Point,Point::dimension+1> PointArray;
+    /**
+     * Type used to represent the size of the array
+     */
+    typedef typename PointArray::size_type SizeArray;
+    /**
+     * static size of the array, ie. the dimension plus one
+     */
+    static const SizeArray size = Point::dimension+1;
+
+    /**
+     * Type of integer used for the exact computations
+     */
+    typedef TInteger Integer;
+    BOOST_CONCEPT_ASSERT(( concepts::CEuclideanRing<Integer> ));
+
+    /**
+     * Type of integer for the result
+     */
+    typedef Integer Value;
+
+    /**
+     * Type of the orientation functor used at initialization
+     */
+    typedef InHalfSpaceByFilteredDet<Point, Integer> Orientation;
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+     * Constructor.
+     * @param aMaxCoordinate if positive, a bound on the absolute value
+     * of the coordinates of all the points, which enables the static
+     * filter. Default to 0 (dynamic filter only).
+     */
+    InBallByFilteredDet( double aMaxCoordinate = 0.0 );
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Initialisation in dimension 2.
+     * @param aP first point
+     * @param aQ second point
+     * @param aR third point
+     * @pre the points are not collinear.
+     */
+    void init(const Point& aP, const Point& aQ, const Point& aR);
+
+    /**
+     * Initialisation in dimension 3.
+     * @param aP first point
+     * @param aQ second point
+     * @param aR third point
+     * @param aS fourth point
+     * @pre the points are not coplanar.
+     */
+    void init(const Point& aP, const Point& aQ, const Point& aR, const Point& aS);
+
+    /**
+     * Initialisation.
+     * @param aA array of three points in dimension 2, four points in
+     * dimension 3.
+     */
+    void init(const PointArray& aA);
+
+    /**
+     * Main operator.
+     * @warning init() should be called before
+     * @param aT any point to test
+     * @return -1, 0 or 1 if @a aT lies respectively in the interior,
+     * on the boundary or in the exterior of the circle (resp. sphere)
+     * passing by the points given at initialization.
+     */
+    Value operator()(const Point& aT) const;
+
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+
+    /**
+     * Points given at initialization.
+     */
+    PointArray myPoints;
+    /**
+     * Coordinates of the first point, as doubles.
+     */
+    double myOrigin[ 3 ];
+    /**
+     * Cofactors of the lifted determinant along the row of the tested
+     * point (coordinates, then lifted coordinate), multiplied by the
+     * orientation of the given points.
+     */
+    double myCofactors[ 4 ];
+    /**
+     * Permanents of the cofactors, ie. the sums of the absolute values
+     * of the products involved in their computation.
+     */
+    double myPermanents[ 4 ];
+    /**
+     * Orientation of the points given at initialization.
+     */
+    Value myOrientation;
+    /**
+     * 'true' iff their coordinates are within the static bound
+     * (or within \f$ 2^{52} \f$ for the dynamic filter).
+     */
+    bool myStaticOk, myFilterOk;
+    /**
+     * Bound on the absolute value of the coordinates for the static
+     * filter (0 if none).
+     */
+    double myMaxCoordinate;
+    /**
+     * Error bound of the static filter.
+     */
+    double myStaticErrorBound;
+
+    // ------------------------- Internals ------------------------------------
+  private:
+
+    /**
+     * Computes the orientation and the cofactors of the points given
+     * at initialization.
+     */
+    void initCofactors();
+
+    /**
+     * @param aT any point
+     * @return the exact position of @a aT.
+     */
+    Value exactPosition(const Point& aT) const;
+
+  }; // end of class InBallByFilteredDet
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'InBallByFilteredDet'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'InBallByFilteredDet' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TPoint, typename TInteger>
+  std::ostream&
+  operator<< ( std::ostream & out, const InBallByFilteredDet<TPoint, TInteger> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/geometry/tools/determinant/InBallByFilteredDet.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined InBallByFilteredDet_h
+
+#undef InBallByFilteredDet_RECURSES
+#endif // else defined(InBallByFilteredDet_RECURSES)
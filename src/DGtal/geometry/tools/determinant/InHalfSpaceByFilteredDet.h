@@ -0,0 +1,274 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file InHalfSpaceByFilteredDet.h
+ *
+ * @author DGtal development team (\c dgtal-devel@lists.gforge.liris.cnrs.fr )
+ *
+ * @date 2026/10/19
+ *
+ * Header file for module InHalfSpaceByFilteredDet.cpp
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(InHalfSpaceByFilteredDet_RECURSES)
+#error Recursive header files inclusion detected in InHalfSpaceByFilteredDet.h
+#else // defined(InHalfSpaceByFilteredDet_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define InHalfSpaceByFilteredDet_RECURSES
+
+#if !defined InHalfSpaceByFilteredDet_h
+/** Prevents repeated inclusion of headers. */
+#define InHalfSpaceByFilteredDet_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <array>
+#include "DGtal/base/Common.h"
+
+#include "DGtal/kernel/NumberTraits.h"
+#include "DGtal/kernel/CEuclideanRing.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class InHalfSpaceByFilteredDet
+  /**
+   * \brief Aim: Class that implements an exact orientation functor
+   * in dimension 2 or 3, ie. it provides a way to compute the
+   * orientation of three 2d points or of four 3d points.
+   * More precisely, it returns:
+   * - zero if the points belong to the same line (resp. plane)
+   * - strictly positive if the points are counter-clockwise oriented
+   * (resp. if the last point lies on the side of the plane
+   * pointed by the normal vector \f$ (Q-P) \times (R-P) \f$)
+   * - strictly negative otherwise.
+   *
+   * The determinant of the difference vectors is first evaluated
+   * with doubles. Its sign is returned when its absolute value is
+   * greater than an upper bound of the rounding error [Shewchuk,
+   * 1997]. Otherwise, or if a coordinate is greater than
+   * \f$ 2^{52} \f$ in absolute value, the determinant is computed
+   * exactly with integers of type TInteger. Since the filter fails
+   * only for (quasi-)degenerate configurations, the result is exact
+   * for the cost of a floating-point evaluation in most cases.
+   *
+   * The error bound is either computed from the actual points
+   * (dynamic filter), or, if a bound on the absolute value of the
+   * coordinates is given at construction, once for all (static
+   * filter), which is faster. Points whose coordinates exceed this
+   * bound are handled by the dynamic filter.
+   *
+   * Basic usage:
+   @code
+   ...
+   typedef Z3i::Point Point;
+   typedef InHalfSpaceByFilteredDet<Point, DGtal::BigInteger> MyType;
+
+   MyType orientationTest( 1000 ); //coordinates within [-1000,1000]
+   orientationTest.init( Point(0,0,0), Point(1,0,0), Point(0,1,0) );
+   return orientationTest( Point(1,1,1) );
+   //a strictly positive value is returned
+   @endcode
+   *
+   * This class is a model of COrientationFunctor, and of
+   * COrientationFunctor2 in dimension 2.
+   *
+   * @tparam TPoint a model of point of dimension 2 or 3
+   * @tparam TInteger a model of integer used when the filter fails,
+   * at least a model of CEuclideanRing. If the point coordinates are
+   * coded with b bits, TInteger must represent integers with 2b+3
+   * bits in dimension 2 and 3b+5 bits in dimension 3 (e.g.
+   * DGtal::int64_t for 2d points with coordinates in
+   * \f$ ]-2^{30};2^{30}[ \f$, DGtal::BigInteger in general).
+   *
+   * @see InHalfPlaneBySimple3x3Matrix InBallByFilteredDet
+   */
+  template <typename TPoint, typename TInteger>
+  class InHalfSpaceByFilteredDet
+  {
+    // ----------------------- Types  ------------------------------------
+  public:
+
+    /**
+     * Type of points
+     */
+    typedef TPoint Point;
+    BOOST_STATIC_ASSERT(( ( Point::dimension == 2 ) || ( Point::dimension == 3 ) ));
+
+    /**
+     * Type of point array
+     */
+    typedef std::array<Point,Point::dimension> PointArray;
+    /**
+     * Type used to represent the size of the array
+     */
+    typedef typename PointArray::size_type SizeArray;
+    /**
+     * static size of the array, ie. the dimension
+     */
+    static const SizeArray size = Point::dimension;
+
+    /**
+     * Type of integer used for the exact computations
+     */
+    typedef TInteger Integer;
+    BOOST_CONCEPT_ASSERT(( concepts::CEuclideanRing<Integer> ));
+
+    /**
+     * Type of integer for the result
+     */
+    typedef Integer Value;
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+     * Constructor.
+     * @param aMaxCoordinate if positive, a bound on the absolute value
+     * of the coordinates of all the points, which enables the static
+     * filter. Default to 0 (dynamic filter only).
+     */
+    InHalfSpaceByFilteredDet( double aMaxCoordinate = 0.0 );
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Initialisation in dimension 2.
+     * @param aP first point
+     * @param aQ second point
+     */
+    void init(const Point& aP, const Point& aQ);
+
+    /**
+     * Initialisation in dimension 3.
+     * @param aP first point
+     * @param aQ second point
+     * @param aR third point
+     */
+    void init(const Point& aP, const Point& aQ, const Point& aR);
+
+    /**
+     * Initialisation.
+     * @param aA array of two points in dimension 2, three points in
+     * dimension 3.
+     */
+    void init(const PointArray& aA);
+
+    /**
+     * Main operator.
+     * @warning init() should be called before
+     * @param aS any point to test
+     * @return orientation of the points given at initialization
+     * followed by @a aS, ie. -1, 0 or 1.
+     */
+    Value operator()(const Point& aS) const;
+
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+
+    /**
+     * Points given at initialization.
+     */
+    PointArray myPoints;
+    /**
+     * The coordinates of the first point and of the difference vectors
+     * from the first point to the other ones, as doubles.
+     */
+    double myCoords[ 3 ][ 3 ];
+    /**
+     * In dimension 3, cross product of the difference vectors Q-P and
+     * R-P, and the sums of the absolute values of the products
+     * involved in each of its components.
+     */
+    double myCross[ 3 ], myCrossPermanent[ 3 ];
+    /**
+     * 'true' iff their coordinates are within the static bound
+     * (or within \f$ 2^{52} \f$ for the dynamic filter).
+     */
+    bool myStaticOk, myFilterOk;
+    /**
+     * Bound on the absolute value of the coordinates for the static
+     * filter (0 if none).
+     */
+    double myMaxCoordinate;
+    /**
+     * Error bound of the static filter.
+     */
+    double myStaticErrorBound;
+
+    // ------------------------- Internals ------------------------------------
+  private:
+
+    /**
+     * @param aS any point
+     * @return the exact orientation of the initial points and @a aS.
+     */
+    Value exactOrientation(const Point& aS) const;
+
+    /**
+     * Stores the coordinates of the initial points as doubles.
+     */
+    void initCoordinates();
+
+  }; // end of class InHalfSpaceByFilteredDet
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'InHalfSpaceByFilteredDet'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'InHalfSpaceByFilteredDet' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TPoint, typename TInteger>
+  std::ostream&
+  operator<< ( std::ostream & out, const InHalfSpaceByFilteredDet<TPoint, TInteger> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/geometry/tools/determinant/InHalfSpaceByFilteredDet.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined InHalfSpaceByFilteredDet_h
+
+#undef InHalfSpaceByFilteredDet_RECURSES
+#endif // else defined(InHalfSpaceByFilteredDet_RECURSES)
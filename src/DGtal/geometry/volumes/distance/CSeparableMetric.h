@@ -90,7 +90,9 @@ and
 ### Models
 
 
-ExactPredicateLpSeparableMetric, InexactPredicateLpSeparableMetric
+ExactPredicateLpSeparableMetric, InexactPredicateLpSeparableMetric,
+ExactPredicateAnisotropicL2SeparableMetric, experimental::ChamferNorm2D,
+experimental::ChamferNorm3D
 
 
 ### Notes
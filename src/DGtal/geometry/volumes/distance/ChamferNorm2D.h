@@ -79,6 +79,10 @@ namespace DGtal
      * - hiddenBy predicate is in @f$ O(log^2(n))@f$ 
      * - closest predicate is in @f$ O(log(n))@f$ 
      *
+     * The methods are const and do not modify the mask, hence the
+     * metric can be shared by the parallel (OpenMP) 1D passes of
+     * VoronoiMap. See ChamferNorm3D for the 3D counterpart.
+     *
      * @tparam TSpace a model CSpace of dimension 2.
      *
      */
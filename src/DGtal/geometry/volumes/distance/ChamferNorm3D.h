@@ -0,0 +1,340 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file ChamferNorm3D.h
+ *
+ * @author DGtal development team (\c dgtal-devel@lists.gforge.liris.cnrs.fr )
+ *
+ * @date 2026/10/19
+ *
+ * Header file for module ChamferNorm3D.cpp
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(ChamferNorm3D_RECURSES)
+#error Recursive header files inclusion detected in ChamferNorm3D.h
+#else // defined(ChamferNorm3D_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define ChamferNorm3D_RECURSES
+
+#if !defined ChamferNorm3D_h
+/** Prevents repeated inclusion of headers. */
+#define ChamferNorm3D_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <vector>
+#include <algorithm>
+#include "DGtal/base/Common.h"
+#include "DGtal/kernel/CSpace.h"
+#include "DGtal/kernel/PointVector.h"
+#include "DGtal/kernel/NumberTraits.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+  namespace experimental
+  {
+    /////////////////////////////////////////////////////////////////////////////
+    // template class ChamferNorm3D
+    /**
+     * Description of template class 'ChamferNorm3D' <p>
+     * \brief Aim: implements a model of CSeparableMetric for chamfer
+     * norms in dimension 3.
+     *
+     * A full 3D chamfer mask (e.g. the 3-4-5 mask) is not separable:
+     * the distance to a site cannot be obtained from the distance to
+     * the closest site in each plane, so that the separable
+     * volumetric tools would only approximate its distance
+     * transformation. This class implements instead the 3D chamfer
+     * norm obtained by nesting two 2D chamfer norms:
+     *
+     * @f$ N(x,y,z) = N_a( N_p(x,y), |z| ) @f$
+     *
+     * where @f$ N_p @f$ is the chamfer norm of the planes z=constant
+     * and @f$ N_a @f$ the 2D chamfer norm combining the planar
+     * distance with the distance along the last axis. Such a norm is
+     * monotonic and decomposable along the last axis, hence the
+     * separable computation (VoronoiMap, DistanceTransformation) of
+     * its distance transformation is exact.
+     *
+     * Each 2D norm is given by the normal vectors of the facets of its
+     * unit ball lying in the sector @f$ x \geq y \geq 0 @f$. The
+     * raw distance is evaluated with integers only: with @a a the
+     * weight of the (1,0) move of @f$ N_p @f$, it is the maximal
+     * scalar product between the normals of @f$ N_a @f$ and the
+     * sorted pair @f$ (N_p(x,y), a|z|) @f$. Distances are normalized
+     * such that the axis moves have length 1.
+     *
+     * When both 2D norms are the @a a - @a b mask (normal (a, b-a)),
+     * the moves of the 3x3x3 neighborhood have the weights a, b and
+     * 2b-a, i.e. the 3-4 masks give the 3-4-5 weights on
+     * the 3x3x3 neighborhood (and differ from the 3-4-5 mask for
+     * longer vectors along the last axis).
+     *
+     * As discussed in @cite dcoeurjo_metric14 for ChamferNorm2D, we
+     * have the following properties (for masks of size @a m):
+     *
+     * - distance between two points is in @f$ O(m)@f$
+     * - hiddenBy predicate is in @f$ O(m \log(n))@f$ on a segment of
+     *   size @a n (exact binary search)
+     * - closest predicate is in @f$ O(m)@f$
+     *
+     * All the methods are const and the object has no mutable state,
+     * hence it can be shared by the parallel (OpenMP) 1D passes of
+     * VoronoiMap and DistanceTransformation: large volumes may use
+     * this cheaper approximation of the Euclidean distance.
+     *
+     * @code
+     * typedef experimental::ChamferNorm3D<Z3i::Space> Metric;
+     * Metric mask( 3, 4 );
+     * DistanceTransformation<Z3i::Space, Predicate, Metric> dt( &domain, &predicate, &mask );
+     * @endcode
+     *
+     * @tparam TSpace a model CSpace of dimension 3.
+     *
+     * @see ChamferNorm2D
+     */
+    template <typename TSpace>
+    class ChamferNorm3D
+    {
+      // ----------------------- Standard services ------------------------------
+    public:
+
+      BOOST_CONCEPT_ASSERT(( concepts::CSpace<TSpace> ));
+      BOOST_STATIC_ASSERT( TSpace::dimension == 3 );
+
+      ///Underlying Space
+      typedef TSpace Space;
+
+      ///Type for vectors
+      typedef typename Space::Vector Vector;
+      ///Type for points
+      typedef typename Space::Point Point;
+
+      ///Value type for embedded distance evaluation
+      typedef double Value;
+      ///Value type for exact distance evaluation
+      typedef typename Space::Integer RawValue;
+
+      ///Vector components type
+      typedef typename Vector::Component Abscissa;
+
+      ///Type for the facet normals of the 2D chamfer norms
+      typedef PointVector<2, RawValue> Normal;
+      ///Container for set of normals
+      typedef std::vector< Normal > Normals;
+
+      /**
+       * Constructor from the weights of the 3x3 mask used by both 2D
+       * norms, i.e. of the (1,0) and (1,1) moves (default: 3-4 mask).
+       *
+       * @pre @f$ 0 < a \leq b \leq 2a @f$ (norm conditions).
+       *
+       * @param a the weight of the (1,0) move.
+       * @param b the weight of the (1,1) move.
+       */
+      ChamferNorm3D( const RawValue a = 3, const RawValue b = 4 );
+
+      /**
+       * Constructor from the normals of the facets of the unit balls
+       * of the two 2D norms.
+       *
+       * @param aPlaneNormalSet the (integer) normals of the facets of
+       * the unit ball of the norm of the planes z=constant.
+       *
+       * @param aAxisNormalSet the (integer) normals of the facets of
+       * the unit ball of the norm combining the planar distance with
+       * the last coordinate.
+       *
+       * Normals are canonicalized (absolute values sorted in
+       * decreasing order).
+       */
+      ChamferNorm3D( const Normals &aPlaneNormalSet,
+                     const Normals &aAxisNormalSet );
+
+      /**
+       * Destructor.
+       */
+      ~ChamferNorm3D();
+
+      // ----------------------- Interface --------------------------------------
+    public:
+
+      /// @return the facet normals of the norm of the planes z=constant.
+      const Normals & planeNormals() const
+      {
+        return myPlaneNormals;
+      }
+
+      /// @return the facet normals of the norm along the last axis.
+      const Normals & axisNormals() const
+      {
+        return myAxisNormals;
+      }
+
+      /// @return the normalization factor (raw length of the axis moves).
+      Value norm() const
+      {
+        return myNorm;
+      }
+
+      // ----------------------- CMetricSpace concept -----------------------------------
+      /**
+       * Returns the distance for the chamfer norm between P and Q.
+       * @param P a point
+       * @param Q a point
+       * @return the distance between P and Q.
+       */
+      Value operator()(const Point &P, const Point &Q) const;
+
+      /**
+       * Returns the raw distance for the chamfer norm between P and Q.
+       * For chamfer norm, it corresponds to un-normalized distance
+       * value.
+       * @param P a point
+       * @param Q a point
+       * @return the distance between P and Q.
+       */
+      RawValue rawDistance(const Point &P, const Point &Q) const;
+
+      /**
+       * Given an origin and two points, this method decides which one
+       * is closest to the origin.
+       * @param origin the origin
+       * @param first  the first point
+       * @param second the second point
+       * @return a Closest enum: FIRST, SECOND or BOTH.
+       */
+      DGtal::Closest closest(const Point &origin,
+                             const Point &first,
+                             const Point &second) const;
+
+      // ----------- CSeparableMetric concept -----------------------------------
+
+      /**
+       * The main hiddenBy predicate (in @f$ O(m \log(n))@f$).
+       *
+       * @pre u,v and w must be such that u[dim] < v[dim] < w[dim]
+       *
+       * @param u a site
+       * @param v a site
+       * @param w a site
+       * @param startingPoint starting point of the segment
+       * @param endPoint end point of the segment
+       * @param dim direction of the straight line
+       * @return true if (u,w) hides v (strictly).
+       */
+      bool hiddenBy(const Point &u,
+                    const Point &v,
+                    const Point &w,
+                    const Point &startingPoint,
+                    const Point &endPoint,
+                    const Dimension dim) const;
+
+      // ------------------------- Other services ------------------------------
+      /**
+       * Writes/Displays the object on an output stream.
+       * @param out the output stream where the object is written.
+       */
+      void selfDisplay ( std::ostream & out ) const;
+
+      /**
+       * Checks the validity/consistency of the object.
+       * @return 'true' if the object is valid, 'false' otherwise.
+       */
+      bool isValid() const;
+
+      // ------------------------- Internals ------------------------------------
+    private:
+
+      /**
+       * Evaluates a 2D chamfer norm given by its facet normals.
+       * @param aNormals the facet normals (canonical sector).
+       * @param p first coordinate.
+       * @param q second coordinate.
+       * @return the maximal scalar product between the normals and
+       * the sorted absolute coordinates.
+       */
+      static RawValue evaluate( const Normals &aNormals,
+                                RawValue p, RawValue q );
+
+      /**
+       * Perform a binary search on the segment [lower,upper] to
+       * detect the last point of the segment which is strictly
+       * closer to u than to v.
+       *
+       * @pre u is strictly closer than v to lower, but not to upper.
+       *
+       * @param u a site
+       * @param v a site
+       * @param dim direction of the straight line
+       * @param lower the lower bound of the segment
+       * @param upper the upper bound of the segment
+       * @return the abscissa of this point along dimension dim.
+       */
+      Abscissa binarySearchHidden(const Point &u,
+                                  const Point &v,
+                                  const Dimension dim,
+                                  const Point &lower,
+                                  const Point &upper) const;
+
+      ///Normals of the facets of the planar norm (canonical sector)
+      Normals myPlaneNormals;
+
+      ///Normals of the facets of the norm along the last axis (canonical sector)
+      Normals myAxisNormals;
+
+      ///Weight of the (1,0) move of the planar norm
+      RawValue myPlaneUnit;
+
+      ///Normalization factor (raw length of the axis moves)
+      Value myNorm;
+
+    }; // end of class ChamferNorm3D
+
+  }//namespace experimental
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'ChamferNorm3D'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'ChamferNorm3D' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename T>
+  std::ostream&
+  operator<< ( std::ostream & out,
+               const experimental::ChamferNorm3D<T> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/geometry/volumes/distance/ChamferNorm3D.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined ChamferNorm3D_h
+
+#undef ChamferNorm3D_RECURSES
+#endif // else defined(ChamferNorm3D_RECURSES)
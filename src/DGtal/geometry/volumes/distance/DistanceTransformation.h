@@ -74,6 +74,10 @@ namespace DGtal
    * Please refer to VoronoiMap documentation for details on the
    * computational cost and parameter description.
    *
+   * After local edits of the point predicate (a few sites added or
+   * removed), the distance transformation can be updated in place
+   * with VoronoiMap::update.
+   *
    * This class is a model of concepts::CConstImage.
    *
    * @tparam TSpace type of Digital Space (model of concepts::CSpace).
@@ -0,0 +1,278 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file ExactPredicateAnisotropicL2SeparableMetric.h
+ *
+ * @author DGtal development team (\c dgtal-devel@lists.gforge.liris.cnrs.fr )
+ *
+ * @date 2026/10/19
+ *
+ * Header file for module ExactPredicateAnisotropicL2SeparableMetric.cpp
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(ExactPredicateAnisotropicL2SeparableMetric_RECURSES)
+#error Recursive header files inclusion detected in ExactPredicateAnisotropicL2SeparableMetric.h
+#else // defined(ExactPredicateAnisotropicL2SeparableMetric_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define ExactPredicateAnisotropicL2SeparableMetric_RECURSES
+
+#if !defined ExactPredicateAnisotropicL2SeparableMetric_h
+/** Prevents repeated inclusion of headers. */
+#define ExactPredicateAnisotropicL2SeparableMetric_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <cmath>
+#include <array>
+#include "DGtal/base/Common.h"
+#include "DGtal/kernel/CInteger.h"
+#include "DGtal/kernel/CSpace.h"
+#include "DGtal/kernel/NumberTraits.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class ExactPredicateAnisotropicL2SeparableMetric
+  /**
+   * Description of template class
+   * 'ExactPredicateAnisotropicL2SeparableMetric' <p> \brief Aim:
+   * implements the Euclidean metric of an anisotropic grid (each
+   * axis having its own spacing) as a model of CSeparableMetric,
+   * with exact predicates.
+   *
+   * Given integer weights @f$ (w_0...w_{n-1})@f$ and a unit @f$
+   * \lambda @f$, the distance between two points @f$
+   * x=(x_0...x_{n-1})@f$ and @f$ y=(y_0...y_{n-1})@f$ is
+   *
+   * @f$ distance(x,y)= \frac{1}{\lambda} \left( \sum_{i=0}^{n-1}
+   * w_i^2 (x_i-y_i)^2\right)^{1/2}@f$
+   *
+   * The weights are the grid spacings scaled to integers, so that
+   * the raw distance (the weighted sum of squares), the @a closest
+   * and the @a hiddenBy predicates are computed without error if @a
+   * TRawValue can hold the weighted sums. For instance, a CT volume
+   * with a voxel spacing of 0.7 x 0.7 x 2.5 mm is handled with the
+   * weights (7,7,25) and the unit 10, distances being then given in
+   * millimeters.
+   *
+   * As the Lp metrics, this metric can be used in all separable
+   * volumetric tools (VoronoiMap, DistanceTransformation), hence in
+   * their parallel (OpenMP) 1D passes. The hiddenBy predicate is in
+   * @f$ O(n)@f$ (no binary search).
+   *
+   * @code
+   * typedef ExactPredicateAnisotropicL2SeparableMetric<Z3i::Space> Metric;
+   * Metric metric( Z3i::Vector( 7, 7, 25 ), 10.0 );
+   * DistanceTransformation<Z3i::Space, Predicate, Metric> dt( &domain, &predicate, &metric );
+   * @endcode
+   *
+   * @tparam TSpace the model of CSpace on which the metric is
+   * defined.
+   * @tparam TRawValue model of CSignedInteger used to store weighted
+   * sums of squares (default: DGtal::int64_t).
+   */
+  template <typename TSpace, typename TRawValue=DGtal::int64_t>
+  class ExactPredicateAnisotropicL2SeparableMetric
+  {
+    // ----------------------- Standard services ------------------------------
+  public:
+    ///Copy the space type
+    typedef TSpace Space;
+    BOOST_CONCEPT_ASSERT(( concepts::CSpace<TSpace> ));
+
+    ///Type for points
+    typedef typename Space::Point Point;
+    ///Type for points
+    typedef typename Point::Coordinate Abscissa;
+    ///Type for vectors
+    typedef typename Space::Vector Vector;
+
+    ///Type for internal distance values
+    typedef TRawValue RawValue;
+    BOOST_CONCEPT_ASSERT(( concepts::CInteger<RawValue> ));
+
+    ///Type for distance values
+    typedef double Value;
+
+    ///Self type
+    typedef ExactPredicateAnisotropicL2SeparableMetric<TSpace,RawValue> Self;
+
+    /**
+     * Constructor.
+     *
+     * @param aWeights the (positive) integer weight of each axis,
+     * i.e. the grid spacing scaled to integers (default: isotropic
+     * grid).
+     * @param aUnit the normalization factor of the distances (the
+     * scale applied to the spacings, default: 1.0).
+     */
+    ExactPredicateAnisotropicL2SeparableMetric( const Vector & aWeights = Vector::diagonal( 1 ),
+                                                const Value aUnit = 1.0 );
+
+    /**
+     * Destructor.
+     */
+    ~ExactPredicateAnisotropicL2SeparableMetric();
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /// @return the weight of each axis.
+    const Vector & weights() const
+    {
+      return myWeights;
+    }
+
+    /// @return the normalization factor of the distances.
+    Value unit() const
+    {
+      return myUnit;
+    }
+
+    // ----------------------- CLocalMetric --------------------------------------
+    /**
+     * Compute the local distance between @a aP and its displacement
+     * along the direction @a aDir.
+     *
+     * @param aP a point.
+     * @param aDir a direction.
+     *
+     * @return the distance between @a aP and @a aP+@a aDir.
+     */
+    Value local(const Point & aP, const Vector &aDir) const;
+
+    // ----------------------- CMetric --------------------------------------
+    /**
+     * Compute the distance between @a aP and @a aQ.
+     *
+     * @param aP a first point.
+     * @param aQ a second point.
+     *
+     * @return the distance between aP and aQ.
+     */
+    Value operator()(const Point & aP, const Point &aQ) const;
+
+    /**
+     * Given an origin and two points, this method decides which one
+     * is closest to the origin. This method should be faster than
+     * comparing distance values.
+     *
+     * @param origin the origin
+     * @param first  the first point
+     * @param second the second point
+     *
+     * @return a Closest enum: FIRST, SECOND or BOTH.
+     */
+    Closest closest(const Point &origin,
+                    const Point &first,
+                    const Point &second) const;
+
+    /**
+     * Compute an exact representation of the distance, i.e. the
+     * weighted sum of squares @f$ \sum w_i^2 (p_i- q_i)^2@f$ (neither
+     * the square root nor the unit are applied).
+     *
+     * @param aP a first point
+     * @param aQ a second point
+     *
+     * @return the raw distance between aP and aQ.
+     */
+    RawValue rawDistance(const Point &aP, const Point &aQ) const;
+
+    // ----------------------- CSeparableMetric --------------------------------------
+    /**
+     * Given three sites (u,v,w) and a straight segment
+     * [startingPoint,endPoint] along dimension dim, we detect if the
+     * voronoi cells of @a u and @a w strictly hide the voronoi cell
+     * of @a v on the straight line.
+     *
+     * @pre u,v and w must be such that u[dim] < v[dim] < w[dim]
+     *
+     * @param u a site
+     * @param v a site
+     * @param w a site
+     * @param startingPoint starting point of the segment
+     * @param endPoint end point of the segment
+     * @param dim direction of the straight line
+     *
+     * @return true if (u,w) hides v (strictly).
+     */
+    bool hiddenBy(const Point &u,
+                  const Point &v,
+                  const Point &w,
+                  const Point &startingPoint,
+                  const Point &endPoint,
+                  const typename Point::UnsignedComponent dim) const;
+
+    // ----------------------- Other services --------------------------------------
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+
+    /// The weight of each axis.
+    Vector myWeights;
+
+    /// The squared weight of each axis.
+    std::array<RawValue, Space::dimension> mySquaredWeights;
+
+    /// The normalization factor of the distances.
+    Value myUnit;
+
+  }; // end of class ExactPredicateAnisotropicL2SeparableMetric
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'ExactPredicateAnisotropicL2SeparableMetric'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'ExactPredicateAnisotropicL2SeparableMetric' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename T, typename P>
+  std::ostream&
+  operator<< ( std::ostream & out, const ExactPredicateAnisotropicL2SeparableMetric<T,P> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/geometry/volumes/distance/ExactPredicateAnisotropicL2SeparableMetric.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined ExactPredicateAnisotropicL2SeparableMetric_h
+
+#undef ExactPredicateAnisotropicL2SeparableMetric_RECURSES
+#endif // else defined(ExactPredicateAnisotropicL2SeparableMetric_RECURSES)
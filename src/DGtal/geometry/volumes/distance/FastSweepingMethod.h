@@ -0,0 +1,383 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file FastSweepingMethod.h
+ *
+ * @author DGtal development team (\c dgtal-devel@lists.gforge.liris.cnrs.fr )
+ *
+ * @date 2026/10/19
+ *
+ * @brief Fast Sweeping Method for distance transforms, with the
+ * inputs and outputs of FMM
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(FastSweepingMethod_RECURSES)
+#error Recursive header files inclusion detected in FastSweepingMethod.h
+#else // defined(FastSweepingMethod_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define FastSweepingMethod_RECURSES
+
+#if !defined FastSweepingMethod_h
+/** Prevents repeated inclusion of headers. */
+#define FastSweepingMethod_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <limits>
+#include <vector>
+#include <array>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/ConstAlias.h"
+#include "DGtal/images/CImage.h"
+#include "DGtal/images/ImageHelper.h"
+#include "DGtal/kernel/sets/CDigitalSet.h"
+#include "DGtal/kernel/CPointPredicate.h"
+#include "DGtal/kernel/CPointFunctor.h"
+#include "DGtal/geometry/volumes/distance/FMMPointFunctors.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class FastSweepingMethod
+  /**
+   * Description of template class 'FastSweepingMethod' <p>
+   * \brief Aim: Fast Sweeping Method for nd distance transforms, a
+   * parallel alternative to FMM with the same inputs and outputs.
+   *
+   * As in FMM, a signed distance function is computed from an
+   * initial set of accepted points, whose distance values are known,
+   * within the points of the image domain for which a point predicate
+   * returns 'true'. The distance value of a point is computed from
+   * the values of its neighbors by a point functor
+   * (L2FirstOrderLocalDistance by default). Instead of accepting the
+   * points in increasing order of distance, the domain is swept in
+   * each of the @f$ 2^d @f$ diagonal directions, and the value of each
+   * point is replaced by the one given by the point functor if its
+   * absolute value is smaller. Sweeps are repeated until no value
+   * changes, which gives the first order upwind solution computed by
+   * FMM.
+   *
+   * Each sweep visits the diagonal hyperplanes (points of constant
+   * coordinate sum in the direction of the sweep) one after the
+   * other. Only the points of the domain are enumerated on each
+   * hyperplane. The 1-neighbors of a point lie on the previous or the
+   * next hyperplane, hence the points of a hyperplane are processed in
+   * parallel (OpenMP, one parallel region per sweep) with a copy of the
+   * point functor per thread; the new values of a hyperplane are then
+   * stored into the image and the set of accepted points, so that any
+   * image and set types can be used.
+   *
+   * The point functor must be monotone, i.e. its value must not
+   * decrease when the values of the neighbors increase, as
+   * L2FirstOrderLocalDistance and L1LocalDistance. LInfLocalDistance
+   * depends on the order in which FMM accepts the points and is not
+   * supported.
+   *
+   * The number of sweeps does not depend on the size of the domain
+   * but on the shape of the characteristics. Only the points having
+   * a neighbor whose value has been set since their last update are
+   * updated, so that the last sweeps are cheap, and no priority queue
+   * is needed, against @f$ O(n \log n) @f$ operations for FMM. A
+   * value is replaced only if it decreases by more than a relative
+   * tolerance of @f$ 10^{-12} @f$, which avoids sweeping for
+   * round-off changes.
+   *
+   * @code
+   * typedef FastSweepingMethod<Image, Set, DomainPredicate<Domain> > FSM;
+   * FSM fsm( map, set, dp );
+   * fsm.compute();
+   * @endcode
+   *
+   * @tparam TImage  any model of CImage
+   * @tparam TSet  any model of CDigitalSet
+   * @tparam TPointPredicate  any model of concepts::CPointPredicate,
+   * used to bound the computation within the image domain
+   * @tparam TPointFunctor  any model of CPointFunctor,
+   * used to compute the new distance value
+   *
+   * @see FMM
+   * @see testFMM.cpp
+   */
+  template <typename TImage, typename TSet, typename TPointPredicate,
+            typename TPointFunctor = L2FirstOrderLocalDistance<TImage,TSet> >
+  class FastSweepingMethod
+  {
+
+    // ----------------------- Types ------------------------------
+  public:
+
+    //concept assert
+    BOOST_CONCEPT_ASSERT(( concepts::CImage<TImage> ));
+    BOOST_CONCEPT_ASSERT(( concepts::CDigitalSet<TSet> ));
+    BOOST_CONCEPT_ASSERT(( concepts::CPointPredicate<TPointPredicate> ));
+    BOOST_CONCEPT_ASSERT(( concepts::CPointFunctor<TPointFunctor> ));
+
+    typedef TImage Image;
+    typedef TSet AcceptedPointSet;
+    typedef TPointPredicate PointPredicate;
+
+    //points
+    typedef typename Image::Point Point;
+    typedef typename Image::Domain Domain;
+    BOOST_STATIC_ASSERT(( boost::is_same< Point, typename AcceptedPointSet::Point >::value ));
+    BOOST_STATIC_ASSERT(( boost::is_same< Point, typename PointPredicate::Point >::value ));
+
+    //dimension
+    typedef typename Point::Dimension Dimension;
+    typedef typename Point::Coordinate Coordinate;
+
+    //distance
+    typedef TPointFunctor PointFunctor;
+    typedef typename PointFunctor::Value Value;
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+     * Constructor.
+     *
+     * @param aImg the distance image, whose domain bounds the
+     * computation.
+     * @param aSet the set of accepted points, i.e. of the points of
+     * @a aImg whose value is known.
+     * @param aPointPredicate predicate returning 'true' inside the
+     * domain where the distance transform is performed.
+     */
+    FastSweepingMethod( Image& aImg, AcceptedPointSet& aSet,
+                        ConstAlias<PointPredicate> aPointPredicate );
+
+    /**
+     * Constructor.
+     *
+     * @param aImg the distance image, whose domain bounds the
+     * computation.
+     * @param aSet the set of accepted points.
+     * @param aPointPredicate predicate returning 'true' inside the
+     * domain where the distance transform is performed.
+     * @param aValueThreshold value threshold: the points whose
+     * absolute value is not smaller are not accepted.
+     */
+    FastSweepingMethod( Image& aImg, AcceptedPointSet& aSet,
+                        ConstAlias<PointPredicate> aPointPredicate,
+                        const Value& aValueThreshold );
+
+    /**
+     * Constructor.
+     *
+     * @param aImg the distance image, whose domain bounds the
+     * computation.
+     * @param aSet the set of accepted points.
+     * @param aPointPredicate predicate returning 'true' inside the
+     * domain where the distance transform is performed.
+     * @param aPointFunctor the point functor (copied by each thread).
+     */
+    FastSweepingMethod( Image& aImg, AcceptedPointSet& aSet,
+                        ConstAlias<PointPredicate> aPointPredicate,
+                        PointFunctor& aPointFunctor );
+
+    /**
+     * Constructor.
+     *
+     * @param aImg the distance image, whose domain bounds the
+     * computation.
+     * @param aSet the set of accepted points.
+     * @param aPointPredicate predicate returning 'true' inside the
+     * domain where the distance transform is performed.
+     * @param aValueThreshold value threshold: the points whose
+     * absolute value is not smaller are not accepted.
+     * @param aPointFunctor the point functor (copied by each thread).
+     */
+    FastSweepingMethod( Image& aImg, AcceptedPointSet& aSet,
+                        ConstAlias<PointPredicate> aPointPredicate,
+                        const Value& aValueThreshold,
+                        PointFunctor& aPointFunctor );
+
+    /**
+     * Destructor.
+     */
+    ~FastSweepingMethod();
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Computation of the signed distance function by sweeping the
+     * domain until no value changes. The points of the initial set
+     * of accepted points keep their value, the other points reached
+     * are inserted into the set.
+     */
+    void compute();
+
+    /**
+     * @return the number of sweeps of the last computation (including
+     * the last @f$ 2^d @f$ sweeps without any change).
+     */
+    unsigned int nbSweeps() const
+    {
+      return myNbSweeps;
+    }
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+  private:
+
+    /**
+     * Copy constructor.
+     * @param other the object to clone.
+     * Forbidden by default.
+     */
+    FastSweepingMethod ( const FastSweepingMethod & other );
+
+    /**
+     * Assignment.
+     * @param other the object to copy.
+     * @return a reference on 'this'.
+     * Forbidden by default.
+     */
+    FastSweepingMethod & operator= ( const FastSweepingMethod & other );
+
+    // ------------------------- Internals ------------------------------------
+  private:
+
+    /**
+     * @param aPoint any point of the image domain.
+     * @return its index in the flag arrays.
+     */
+    std::size_t index( const Point & aPoint ) const;
+
+    /**
+     * Marks the neighbors of a point as points to update.
+     *
+     * @param aPoint any point of the image domain, whose value has
+     * been set.
+     */
+    void activateNeighbors( const Point & aPoint );
+
+    /**
+     * Gathers the points to update of a diagonal hyperplane, i.e. the
+     * active points that are not initial points, and marks them as
+     * inactive. Only the points of the domain are enumerated.
+     *
+     * @param aDirection the direction, the bit k being set if the
+     * coordinate k decreases.
+     * @param aSum the sum of the coordinates of the points, relative
+     * to the first corner of the domain in this direction.
+     * @param aPoints (returned) the points to update.
+     */
+    void hyperplanePoints( const unsigned int aDirection, const Coordinate aSum,
+                           std::vector<Point> & aPoints );
+
+    /**
+     * Sweeps the domain in one diagonal direction.
+     *
+     * @param aDirection the direction, the bit k being set if the
+     * coordinate k decreases.
+     * @param aPoints buffer for the points to update of a hyperplane.
+     * @param aValues buffer for the new values of a hyperplane.
+     * @param aFlags buffer for the changes of a hyperplane.
+     * @return 'true' if a value has changed, 'false' otherwise.
+     */
+    bool sweep( const unsigned int aDirection, std::vector<Point> & aPoints,
+                std::vector<Value> & aValues, std::vector<char> & aFlags );
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+
+    /// Reference on the image
+    Image& myImage;
+
+    /// Reference on the set of accepted points
+    AcceptedPointSet& myAcceptedPoints;
+
+    /// Pointer on the point functor copied by each thread (owning
+    /// or aliasing pointer, see myFlagIsOwning)
+    PointFunctor* myPointFunctorPtr;
+
+    /// 'true' if @a myPointFunctorPtr is an owning pointer
+    const bool myFlagIsOwning;
+
+    /// Constant reference on the point predicate
+    const PointPredicate& myPointPredicate;
+
+    /// Value threshold
+    Value myValueThreshold;
+
+    /// Lower bound of the image domain
+    Point myLowerBound;
+
+    /// Upper bound of the image domain
+    Point myUpperBound;
+
+    /// The offsets of the indices along each axis.
+    std::array<std::size_t, Point::dimension> myStrides;
+
+    /// The flags of the initial points (1), of the points reached
+    /// since (2) and of the points not reached (0).
+    std::vector<char> myStates;
+
+    /// The flags of the points having a neighbor whose value has
+    /// been set since their last update.
+    std::vector<char> myActive;
+
+    /// The number of sweeps of the last computation.
+    unsigned int myNbSweeps;
+
+  }; // end of class FastSweepingMethod
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'FastSweepingMethod'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'FastSweepingMethod' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TImage, typename TSet, typename TPointPredicate, typename TPointFunctor >
+  std::ostream&
+  operator<< ( std::ostream & out,
+               const FastSweepingMethod<TImage, TSet, TPointPredicate, TPointFunctor> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/geometry/volumes/distance/FastSweepingMethod.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined FastSweepingMethod_h
+
+#undef FastSweepingMethod_RECURSES
+#endif // else defined(FastSweepingMethod_RECURSES)
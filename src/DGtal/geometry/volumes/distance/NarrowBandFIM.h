@@ -0,0 +1,345 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file NarrowBandFIM.h
+ *
+ * @author DGtal development team (\c dgtal-devel@lists.gforge.liris.cnrs.fr )
+ *
+ * @date 2026/10/19
+ *
+ * @brief Narrow band distance transform by a tiled Fast Iterative
+ * Method
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(NarrowBandFIM_RECURSES)
+#error Recursive header files inclusion detected in NarrowBandFIM.h
+#else // defined(NarrowBandFIM_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define NarrowBandFIM_RECURSES
+
+#if !defined NarrowBandFIM_h
+/** Prevents repeated inclusion of headers. */
+#define NarrowBandFIM_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <limits>
+#include <vector>
+#include <array>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/ConstAlias.h"
+#include "DGtal/kernel/CSpace.h"
+#include "DGtal/kernel/domains/HyperRectDomain.h"
+#include "DGtal/images/ImageContainerBySTLVector.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class NarrowBandFIM
+  /**
+   * Description of template class 'NarrowBandFIM' <p>
+   * \brief Aim: computes a signed distance function in a narrow band
+   * around an initial set of points (e.g. the points incident to the
+   * bels of a digital surface), by a Fast Iterative Method on tiles.
+   *
+   * The computed values are the ones of FMM with the default
+   * L2FirstOrderLocalDistance point functor and a value threshold
+   * equal to the band width: at each point, the first order upwind
+   * discretization of the eikonal equation @f$ |\nabla d| = 1 @f$ is
+   * solved from the smallest neighboring values along each axis, and
+   * the points of absolute value not smaller than the band width are
+   * not computed.
+   *
+   * Instead of accepting the points one by one, the domain is split
+   * into tiles (of side 8 by default) and the active tiles are
+   * processed in parallel (OpenMP): the values of a tile are updated
+   * by alternate sweeps until they do not decrease anymore, the
+   * values of the neighboring tiles being those of the previous
+   * step. The neighbors of the modified tiles are processed at the
+   * next step, until no value decreases. The values are stored in a
+   * dense image of the domain, but only the tiles reached by the band
+   * are processed.
+   *
+   * @code
+   * NarrowBandFIM<Z3i::Space> fim( domain, 5.0 );
+   * fim.initFromBelsRange( K, bels.begin(), bels.end() );
+   * fim.compute();
+   * double d = fim( p ); // infinity outside the band
+   * @endcode
+   *
+   * @tparam TSpace any model of CSpace.
+   *
+   * @see FMM
+   * @see testFMM.cpp
+   */
+  template <typename TSpace>
+  class NarrowBandFIM
+  {
+    // ----------------------- Types ------------------------------
+  public:
+
+    BOOST_CONCEPT_ASSERT(( concepts::CSpace<TSpace> ));
+
+    typedef TSpace Space;
+    typedef HyperRectDomain<Space> Domain;
+    typedef typename Space::Point Point;
+    typedef typename Space::Dimension Dimension;
+
+    ///Type of distance values
+    typedef double Value;
+    ///Type of the image of distance values
+    typedef ImageContainerBySTLVector<Domain, Value> Image;
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+     * Constructor. All the values are initially infinite.
+     *
+     * @param aDomain the domain of computation (aliased).
+     * @param aBandWidth the absolute value above which the
+     * propagation stops.
+     * @param aTileSize the side of the tiles processed in parallel.
+     */
+    NarrowBandFIM( ConstAlias<Domain> aDomain, const Value & aBandWidth,
+                   const typename Point::Coordinate aTileSize = 8 );
+
+    /**
+     * Destructor.
+     */
+    ~NarrowBandFIM();
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Sets the value of an initial point, which is not modified by
+     * the computation.
+     *
+     * @param aPoint any point of the domain.
+     * @param aValue its (signed) distance value.
+     */
+    void setValue( const Point & aPoint, const Value & aValue );
+
+    /**
+     * Initializes the values from the points of the range [@a itb ,
+     * @a ite ), with a distance equal to @a aValue.
+     *
+     * @param itb begin iterator (on points)
+     * @param ite end iterator (on points)
+     * @param aValue distance value (default: 0)
+     */
+    template <typename TIteratorOnPoints>
+    void initFromPointsRange( const TIteratorOnPoints & itb,
+                              const TIteratorOnPoints & ite,
+                              const Value & aValue = 0.0 );
+
+    /**
+     * Initializes the values from the points incident to the signed
+     * cells of the range [@a itb , @a ite ) as FMM::initFromBelsRange:
+     * the inner points have the distance - @a aValue if @a
+     * aFlagIsPositive is 'true' (default) but @a aValue otherwise,
+     * and conversely for the outer points.
+     *
+     * @param aK a Khalimsky space in which the signed cells live.
+     * @param itb begin iterator (on signed cells)
+     * @param ite end iterator (on signed cells)
+     * @param aValue distance value (default: 0.5)
+     * @param aFlagIsPositive The flag controlling the @a aValue sign
+     * assigned to inner points.
+     */
+    template <typename KSpace, typename TIteratorOnBels>
+    void initFromBelsRange( const KSpace & aK,
+                            const TIteratorOnBels & itb,
+                            const TIteratorOnBels & ite,
+                            const Value & aValue = 0.5,
+                            bool aFlagIsPositive = true );
+
+    /**
+     * Computes the distance values in the band.
+     *
+     * @return the number of points with a finite value.
+     */
+    std::size_t compute();
+
+    /**
+     * @param aPoint any point of the domain.
+     * @return the distance value at @a aPoint (infinity outside the
+     * band).
+     */
+    Value operator()( const Point & aPoint ) const
+    {
+      return myImage( aPoint );
+    }
+
+    /**
+     * @return the image of distance values.
+     */
+    const Image & image() const
+    {
+      return myImage;
+    }
+
+    /**
+     * @return the band width.
+     */
+    Value bandWidth() const
+    {
+      return myBandWidth;
+    }
+
+    /**
+     * @return the number of tile updates of the last computation.
+     */
+    std::size_t nbTileUpdates() const
+    {
+      return myNbTileUpdates;
+    }
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+  private:
+
+    /**
+     * Copy constructor.
+     * @param other the object to clone.
+     * Forbidden by default.
+     */
+    NarrowBandFIM ( const NarrowBandFIM & other );
+
+    /**
+     * Assignment.
+     * @param other the object to copy.
+     * @return a reference on 'this'.
+     * Forbidden by default.
+     */
+    NarrowBandFIM & operator= ( const NarrowBandFIM & other );
+
+    // ------------------------- Internals ------------------------------------
+  private:
+
+    /**
+     * @param aPoint any point of the domain.
+     * @return its index in the image.
+     */
+    std::size_t index( const Point & aPoint ) const;
+
+    /**
+     * @param aTile the coordinates of a tile.
+     * @return its index.
+     */
+    std::size_t tileIndex( const Point & aTile ) const;
+
+    /**
+     * Updates the values of a tile until they do not decrease anymore.
+     *
+     * @param aTile the coordinates of the tile.
+     * @param aValues the values being computed (read and written
+     * in the tile only).
+     * @return 'true' if a value has decreased, 'false' otherwise.
+     */
+    bool updateTile( const Point & aTile, std::vector<Value> & aValues ) const;
+
+    /**
+     * Solves the local eikonal equation at a point.
+     *
+     * @param aPoint any point of the domain.
+     * @param aIndex its index in the image.
+     * @param aLower the lower bound of its tile.
+     * @param aUpper the upper bound of its tile.
+     * @param aValues the values in the tile (values outside the
+     * tile are read in the image).
+     * @return the (signed) tentative value.
+     */
+    Value localValue( const Point & aPoint, const std::size_t aIndex,
+                      const Point & aLower, const Point & aUpper,
+                      const std::vector<Value> & aValues ) const;
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+
+    /// The domain.
+    const Domain* myDomain;
+
+    /// The band width.
+    Value myBandWidth;
+
+    /// The side of the tiles.
+    typename Point::Coordinate myTileSize;
+
+    /// The image of distance values.
+    Image myImage;
+
+    /// The flags of the initial points.
+    std::vector<char> myFrozen;
+
+    /// The initial points.
+    std::vector<Point> myInitialPoints;
+
+    /// The offsets of the indices along each axis.
+    std::array<std::size_t, Space::dimension> myStrides;
+
+    /// The number of tiles along each axis.
+    Point myNbTiles;
+
+    /// The number of tile updates of the last computation.
+    std::size_t myNbTileUpdates;
+
+  }; // end of class NarrowBandFIM
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'NarrowBandFIM'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'NarrowBandFIM' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TSpace>
+  std::ostream&
+  operator<< ( std::ostream & out, const NarrowBandFIM<TSpace> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/geometry/volumes/distance/NarrowBandFIM.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined NarrowBandFIM_h
+
+#undef NarrowBandFIM_RECURSES
+#endif // else defined(NarrowBandFIM_RECURSES)
@@ -90,6 +90,11 @@ namespace DGtal
    * class constructor). For Euclidean the @f$ l_2@f$ metric, the
    * overall computation is in @f$ O(d.n^d)@f$, which is optimal.
    *
+   * With OpenMP, the 1D problems of each dimension are solved in
+   * parallel. When the container is an ImageContainerBySTLVector
+   * (default), the initialization of the map is also done by rows in
+   * parallel.
+   *
    * This class is a model of concepts::CConstImage.
    *
    * @see &nbsp; \ref toricVol
@@ -43,7 +43,9 @@
 
 //////////////////////////////////////////////////////////////////////////////
 // Inclusions
+#include <algorithm>
 #include <iostream>
+#include <utility>
 #include <vector>
 #include "DGtal/base/Common.h"
 #include "DGtal/kernel/NumberTraits.h"
@@ -51,6 +53,7 @@
 #include "DGtal/geometry/volumes/distance/PowerMap.h"
 #include "DGtal/images/DefaultConstImageRange.h"
 #include "DGtal/kernel/domains/HyperRectDomain.h"
+#include "DGtal/kernel/domains/Linearizer.h"
 #include "DGtal/images/ImageContainerBySTLMap.h"
 #include "DGtal/images/CImage.h"
 #include "DGtal/images/Image.h"
@@ -80,7 +83,14 @@ namespace DGtal
    * The output is an image associating ball radii (weight of the
    * power map site) to maximal ball centers. Most methods output a
    * lightweight proxy to an image container (of type ImageContainer,
-   * see below).
+   * see below). getReducedMedialAxisBalls outputs instead the sparse
+   * list of maximal balls, which is what compression or
+   * reconstruction workflows need.
+   *
+   * The power cells are scanned by rows in parallel with OpenMP,
+   * each thread marking the sites of its rows in a dense array of
+   * flags; the balls are then gathered in the domain order, hence the
+   * output does not depend on the number of threads.
    *
    * @note Following ReverseDistanceTransformation, the input shape is
    * defined as points with negative power distance.
@@ -99,10 +109,24 @@ namespace DGtal
     //MA Container
     typedef Image<TImageContainer> Type;
 
+    ///Point type
+    typedef typename TPowerMap::Point Point;
+    ///Vector type
+    typedef typename TPowerMap::Vector Vector;
+    ///Value type of the power distance (and of the medial axis image).
+    typedef typename TPowerMap::PowerSeparableMetric::Value Value;
+    ///A maximal ball: its center and its weight (squared radius for l2).
+    typedef std::pair<Point, Value> Ball;
+    ///Sparse medial axis: list of maximal balls, in the domain order.
+    typedef std::vector<Ball> BallRange;
+
     /**
      * Extract reduced medial axis from a power map.
      * This methods is in @f$ O(|powerMap|)@f$.
      *
+     * @note Along periodic dimensions, the ball centers are projected
+     * into the domain.
+     *
      * @param aPowerMap the input powerMap
      *
      * @return a lightweight proxy to the ImageContainer specified in
@@ -113,18 +137,83 @@ namespace DGtal
     {
       TImageContainer *computedMA = new TImageContainer( aPowerMap.domain() );
 
-      for (typename TPowerMap::Domain::ConstIterator it = aPowerMap.domain().begin(),
-             itend = aPowerMap.domain().end(); it != itend; ++it)
-        {
-          const auto v  = aPowerMap( *it );
-          const auto pv = aPowerMap.projectPoint( v );
+      for ( const Ball & ball : getReducedMedialAxisBalls( aPowerMap ) )
+        computedMA->setValue( ball.first, ball.second );
+
+      return Type( computedMA );
+    }
 
-          if ( aPowerMap.metricPtr()->powerDistance( *it, v, aPowerMap.weightImagePtr()->operator()( pv ) )
-                      < NumberTraits<typename TPowerMap::PowerSeparableMetric::Value>::ZERO )
-            computedMA->setValue( v, aPowerMap.weightImagePtr()->operator()( pv ) );
+    /**
+     * Extract the reduced medial axis from a power map as a sparse
+     * list of maximal balls. This methods is in @f$ O(|powerMap|)@f$,
+     * parallel with OpenMP, and its output only uses memory for the
+     * balls (plus one byte per domain point during the computation).
+     *
+     * @note Along periodic dimensions, the ball centers are projected
+     * into the domain.
+     *
+     * @param aPowerMap the input powerMap
+     *
+     * @return the maximal balls (center and weight), sorted in the
+     * order of the domain.
+     */
+    static
+    BallRange getReducedMedialAxisBalls(const TPowerMap &aPowerMap)
+    {
+      typedef typename TPowerMap::Domain Domain;
+      BallRange balls;
+      const Domain & domain = aPowerMap.domain();
+      if ( domain.isEmpty() ) return balls;
+
+      const Point  lo     = domain.lowerBound();
+      const Vector extent = domain.upperBound() - lo + Vector::diagonal( 1 );
+      const std::size_t width  = static_cast<std::size_t>( extent[ 0 ] );
+      const std::size_t size   = static_cast<std::size_t>( domain.size() );
+      const long        nbRows = static_cast<long>( size / width );
+
+      typedef Linearizer<Domain> RowLinearizer;
+
+      //The site of each power cell intersecting the shape is a
+      //maximal ball. Concurrent threads may only set a flag to 1.
+      std::vector<unsigned char> isMedial( size, 0 );
+#ifdef WITH_OPENMP
+#pragma omp parallel for schedule(dynamic,16)
+#endif
+      for ( long r = 0; r < nbRows; ++r )
+        {
+          Point p = RowLinearizer::getPoint( static_cast<std::size_t>( r ) * width,
+                                             lo, extent );
+          for ( std::size_t i = 0; i < width; ++i, ++p[ 0 ] )
+            {
+              const Point v  = aPowerMap( p );
+              const Point pv = aPowerMap.projectPoint( v );
+              if ( ! domain.isInside( pv ) ) continue;
+              if ( aPowerMap.metricPtr()->powerDistance( p, v, aPowerMap.weightImagePtr()->operator()( pv ) )
+                   < NumberTraits<Value>::ZERO )
+                {
+                  unsigned char & flag = isMedial[ RowLinearizer::getIndex( pv, lo, extent ) ];
+#ifdef WITH_OPENMP
+#pragma omp atomic write
+#endif
+                  flag = 1;
+                }
+            }
         }
 
-      return Type( computedMA );
+      //Gathering the balls in the domain order.
+      for ( long r = 0; r < nbRows; ++r )
+        {
+          const std::size_t first = static_cast<std::size_t>( r ) * width;
+          if ( std::find( isMedial.begin() + first,
+                          isMedial.begin() + first + width, 1 )
+               == isMedial.begin() + first + width )
+            continue;
+          Point p = RowLinearizer::getPoint( first, lo, extent );
+          for ( std::size_t i = 0; i < width; ++i, ++p[ 0 ] )
+            if ( isMedial[ first + i ] )
+              balls.push_back( Ball( p, aPowerMap.weightImagePtr()->operator()( p ) ) );
+        }
+      return balls;
     }
   }; // end of class ReducedMedialAxis
 
@@ -0,0 +1,320 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file SurfaceFMM.h
+ *
+ * @author DGtal development team (\c dgtal-devel@lists.gforge.liris.cnrs.fr )
+ *
+ * @date 2026/10/19
+ *
+ * @brief Fast Marching Method for geodesic distances on indexed
+ * digital surfaces
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(SurfaceFMM_RECURSES)
+#error Recursive header files inclusion detected in SurfaceFMM.h
+#else // defined(SurfaceFMM_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define SurfaceFMM_RECURSES
+
+#if !defined SurfaceFMM_h
+/** Prevents repeated inclusion of headers. */
+#define SurfaceFMM_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <limits>
+#include <vector>
+#include <queue>
+#include <utility>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/ConstAlias.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class SurfaceFMM
+  /**
+   * Description of template class 'SurfaceFMM' <p>
+   * \brief Aim: Fast Marching Method (FMM) computing geodesic
+   * distances on an indexed digital surface.
+   *
+   * The vertices of the surface (the surfels) are placed at the
+   * positions precomputed by the indexed surface (surfel centers by
+   * default) and each polygonal face (the surfels around a pointel) is
+   * split into triangles. As in FMM, the distance is computed by
+   * marching out from a set of source vertices: the candidate vertex
+   * of smallest tentative distance is accepted, then the tentative
+   * distances of its neighbors are updated from the accepted
+   * vertices of their edges and triangles. In a triangle (x,a,b), the
+   * tentative distance of x is
+   *
+   * @f$ \min_{\lambda \in [0,1]} \lambda d(a) + (1-\lambda) d(b) +
+   * \| x - (\lambda a + (1-\lambda) b) \| @f$
+   *
+   * which is solved in closed form. The computed distance is thus
+   * never smaller than the Euclidean distance to the sources and
+   * never larger than the shortest path distance along the edges.
+   *
+   * The adjacency of the vertices (neighbors and opposite edges of
+   * their triangles) is extracted once at construction, in compact
+   * arrays (in parallel with OpenMP), so that surfaces of millions of
+   * surfels are processed with a binary heap in @f$ O(n \log n) @f$.
+   * A digital surface (DigitalSurface) is processed by building the
+   * IndexedDigitalSurface of its container.
+   *
+   * @code
+   * typedef IndexedDigitalSurface< DigitalSetBoundary<KSpace,DigitalSet> > Surface;
+   * SurfaceFMM<Surface> fmm( surface );
+   * fmm.setSource( 0 );
+   * fmm.compute();
+   * double d = fmm( 10 ); // geodesic distance between vertices 0 and 10
+   * @endcode
+   *
+   * @tparam TIndexedDigitalSurface an IndexedDigitalSurface (or any
+   * type with the same methods nbVertices, position, outArcs, inArcs,
+   * head, tail, facesAroundVertex and verticesAroundFace).
+   *
+   * @see FMM
+   * @see testFMM.cpp
+   */
+  template <typename TIndexedDigitalSurface>
+  class SurfaceFMM
+  {
+    // ----------------------- Types ------------------------------
+  public:
+
+    typedef TIndexedDigitalSurface Surface;
+    typedef typename Surface::Vertex Vertex;
+    typedef typename Surface::RealPoint RealPoint;
+    typedef typename Surface::Size Size;
+
+    ///Type of distance values
+    typedef double Value;
+    ///Container of distance values (indexed by vertices)
+    typedef std::vector<Value> Values;
+
+  private:
+
+    //intern data types
+    typedef std::pair<Value, Vertex> ValueVertex;
+    typedef std::priority_queue< ValueVertex, std::vector<ValueVertex>,
+                                 std::greater<ValueVertex> > CandidateQueue;
+    typedef std::pair<Vertex, Vertex> VertexPair;
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+     * Constructor. Extracts the adjacency of the vertices of the
+     * surface. No vertex is a source.
+     *
+     * @param aSurface the indexed digital surface (aliased).
+     */
+    SurfaceFMM( ConstAlias<Surface> aSurface );
+
+    /**
+     * Destructor.
+     */
+    ~SurfaceFMM();
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Forgets the sources and the computed distances.
+     */
+    void clear();
+
+    /**
+     * Sets a source vertex, i.e. an accepted vertex of given distance.
+     *
+     * @param aVertex any vertex of the surface.
+     * @param aValue its distance value (default: 0).
+     */
+    void setSource( const Vertex & aVertex, const Value & aValue = 0.0 );
+
+    /**
+     * Computes the geodesic distances by marching out from the
+     * sources, until all the reachable vertices are accepted or the
+     * distance exceeds @a aValueThreshold.
+     *
+     * @param aValueThreshold the distance above which the
+     * propagation stops (default: no threshold).
+     *
+     * @return the number of accepted vertices.
+     */
+    Size compute( const Value & aValueThreshold
+                  = std::numeric_limits<Value>::infinity() );
+
+    /**
+     * @param aVertex any vertex of the surface.
+     * @return 'true' if @a aVertex is a source or has been accepted.
+     */
+    bool isAccepted( const Vertex & aVertex ) const
+    {
+      return myAccepted[ aVertex ] != 0;
+    }
+
+    /**
+     * @param aVertex any vertex of the surface.
+     * @return the distance of @a aVertex to the sources (infinity if
+     * not accepted).
+     */
+    Value operator()( const Vertex & aVertex ) const
+    {
+      return isAccepted( aVertex ) ? myValues[ aVertex ]
+        : std::numeric_limits<Value>::infinity();
+    }
+
+    /**
+     * @return the number of accepted vertices.
+     */
+    Size nbAccepted() const
+    {
+      return myNbAccepted;
+    }
+
+    /**
+     * @return the surface.
+     */
+    const Surface & surface() const
+    {
+      return *mySurface;
+    }
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+  private:
+
+    /**
+     * Copy constructor.
+     * @param other the object to clone.
+     * Forbidden by default.
+     */
+    SurfaceFMM ( const SurfaceFMM & other );
+
+    /**
+     * Assignment.
+     * @param other the object to copy.
+     * @return a reference on 'this'.
+     * Forbidden by default.
+     */
+    SurfaceFMM & operator= ( const SurfaceFMM & other );
+
+    // ------------------------- Internals ------------------------------------
+  private:
+
+    /**
+     * Computes the tentative distance of a vertex from its accepted
+     * neighbors and triangles.
+     *
+     * @param aVertex any vertex.
+     * @return its tentative distance.
+     */
+    Value tentativeValue( const Vertex & aVertex ) const;
+
+    /**
+     * Tentative distance of a point @a x from the edge [a,b] of
+     * accepted vertices.
+     *
+     * @param x the position of the updated vertex.
+     * @param a the position of the first vertex.
+     * @param da the distance of the first vertex.
+     * @param b the position of the second vertex.
+     * @param db the distance of the second vertex.
+     * @return the minimal distance through the edge [a,b].
+     */
+    static Value triangleValue( const RealPoint & x,
+                                const RealPoint & a, const Value & da,
+                                const RealPoint & b, const Value & db );
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+
+    /// The indexed digital surface.
+    const Surface* mySurface;
+
+    /// The offsets of the neighbors of each vertex in myNeighbors.
+    std::vector<std::size_t> myNeighborOffsets;
+
+    /// The neighbors of the vertices.
+    std::vector<Vertex> myNeighbors;
+
+    /// The offsets of the triangles of each vertex in myTriangles.
+    std::vector<std::size_t> myTriangleOffsets;
+
+    /// The edges opposite to each vertex in its triangles.
+    std::vector<VertexPair> myTriangles;
+
+    /// The distance values (tentative ones for the candidates,
+    /// infinity if not reached).
+    Values myValues;
+
+    /// The acceptance flags.
+    std::vector<char> myAccepted;
+
+    /// The candidate vertices with their tentative distance.
+    CandidateQueue myCandidates;
+
+    /// The number of accepted vertices.
+    Size myNbAccepted;
+
+  }; // end of class SurfaceFMM
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'SurfaceFMM'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'SurfaceFMM' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TIndexedDigitalSurface>
+  std::ostream&
+  operator<< ( std::ostream & out, const SurfaceFMM<TIndexedDigitalSurface> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/geometry/volumes/distance/SurfaceFMM.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined SurfaceFMM_h
+
+#undef SurfaceFMM_RECURSES
+#endif // else defined(SurfaceFMM_RECURSES)
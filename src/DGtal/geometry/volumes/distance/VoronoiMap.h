@@ -326,6 +326,37 @@ namespace DGtal
      */
     Point projectPoint( Point aPoint ) const;
 
+    /**
+     * Updates in place the Voronoi map after local edits of the set
+     * of sites, i.e. after the point predicate has changed at a few
+     * points (sites added or removed).
+     *
+     * Only the points whose closest site may change are recomputed.
+     * For each changed point @a e, they are collected by a flood fill
+     * from @a e (@f$ 3^d-1 @f$ neighborhood) among the points @a q
+     * such that @f$ d(q,e) - d(q,site(q)) \leq d(0,(1,...,1)) @f$,
+     * @a site(q) being the previous closest site: this set contains
+     * all the points closer to @a e than to their previous site (or
+     * whose previous site was @a e), since such points are reached by
+     * a digital straight segment towards @a e. The Voronoi map of
+     * these points is then computed on a window around them, which
+     * is enlarged until the closest site found for each point is
+     * closer than the window border. Hence the result is the one of a
+     * full recomputation (up to the choice between equidistant
+     * sites), for a cost related to the size of the modified cells.
+     *
+     * @note The separable metric must be a norm with an axis
+     * symmetric unit ball (all the separable metrics of DGtal are).
+     * On periodic domains, the whole map is recomputed.
+     *
+     * @tparam TPointRange a range of points (e.g. std::vector<Point>).
+     * @param changedPoints the points at which the point predicate
+     * changed since the last computation.
+     * @return the number of points whose value was recomputed.
+     */
+    template <typename TPointRange>
+    std::size_t update( const TPointRange & changedPoints );
+
     /**
      * Self Display method.
      *
@@ -150,6 +150,19 @@ namespace DGtal
      */
     BreadthFirstVisitor( ConstAlias<Graph> graph, const Vertex & p );
 
+    /**
+     * Constructor from a point and a set of marks. This point
+     * provides the initial core of the visitor, and the visited
+     * vertices are marked in a copy of \a marks (for instance an empty
+     * set already sized for the graph).
+     *
+     * @param graph the graph in which the breadth first traversal takes place.
+     * @param p any vertex of the graph.
+     * @param marks the initial set of marked vertices (should not contain \a p).
+     */
+    BreadthFirstVisitor( ConstAlias<Graph> graph, const Vertex & p,
+                         const MarkSet & marks );
+
     /**
        Constructor from iterators. All vertices visited between the
        iterators should be distinct two by two. The so specified set
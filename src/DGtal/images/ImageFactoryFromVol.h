@@ -0,0 +1,231 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file ImageFactoryFromVol.h
+ *
+ * @author DGtal development team (\c dgtal-devel@lists.gforge.liris.cnrs.fr )
+ *
+ * @date 2026/10/19
+ *
+ * Header file for module ImageFactoryFromVol.cpp
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(ImageFactoryFromVol_RECURSES)
+#error Recursive header files inclusion detected in ImageFactoryFromVol.h
+#else // defined(ImageFactoryFromVol_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define ImageFactoryFromVol_RECURSES
+
+#if !defined ImageFactoryFromVol_h
+/** Prevents repeated inclusion of headers. */
+#define ImageFactoryFromVol_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <string>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/ConceptUtils.h"
+#include "DGtal/base/BasicFunctors.h"
+#include "DGtal/images/CImage.h"
+#include "DGtal/io/readers/VolReader.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+  /////////////////////////////////////////////////////////////////////////////
+  // Template class ImageFactoryFromVol
+  /**
+   * Description of template class 'ImageFactoryFromVol' <p>
+   * \brief Aim: implements a factory to produce images from the parts of a Vol file.
+   *
+   * @tparam TImageContainer an image container type (model of CImage).
+   * @tparam TFunctor the type of functor used to cast the Vol values
+   * (unsigned char) into the values of the image container.
+   *
+   * The factory images production is done with the function
+   * 'requestImage', which reads the part of the file lying in the
+   * requested domain (see VolReader::importVol). With chunked Vol
+   * files (see VolWriter::exportChunkedVol), only the bricks
+   * intersecting this domain are read, so that a TiledImage built
+   * on this factory never uncompresses the whole file.
+   *
+   * The deletion must be done with the function 'detachImage'.
+   *
+   * The factory is read-only: the function 'flushImage' does
+   * nothing, hence values modified in the produced images are not
+   * written back to the file.
+   */
+  template <typename TImageContainer,
+            typename TFunctor = functors::Cast< typename TImageContainer::Value > >
+  class ImageFactoryFromVol
+  {
+
+    // ----------------------- Types ------------------------------
+
+  public:
+    typedef ImageFactoryFromVol<TImageContainer, TFunctor> Self;
+
+    ///Checking concepts
+    BOOST_CONCEPT_ASSERT(( concepts::CImage<TImageContainer> ));
+    BOOST_STATIC_ASSERT(( TImageContainer::Domain::dimension == 3 ));
+
+    ///Types copied from the container
+    typedef TImageContainer ImageContainer;
+    typedef typename ImageContainer::Domain Domain;
+    typedef TFunctor Functor;
+
+    ///New types
+    typedef ImageContainer OutputImage;
+    typedef VolReader<ImageContainer, Functor> Reader;
+
+    // ----------------------- Standard services ------------------------------
+
+  public:
+
+    /**
+     * Constructor. Reads the header of the file.
+     * @param aFilename the Vol filename.
+     * @param aFunctor the functor used to cast the Vol values.
+     */
+    ImageFactoryFromVol(const std::string & aFilename,
+                        const Functor & aFunctor = Functor()):
+      myFilename(aFilename), myFunctor(aFunctor),
+      myDomain(Reader::importDomain(aFilename))
+    {
+    }
+
+    /**
+     * Destructor.
+     * Does nothing
+     */
+    ~ImageFactoryFromVol() {}
+
+  private:
+
+    ImageFactoryFromVol( const ImageFactoryFromVol & other );
+
+    ImageFactoryFromVol & operator=( const ImageFactoryFromVol & other );
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /////////////////// Domains //////////////////
+
+    /**
+     * Returns a reference to the domain of the image stored in the file.
+     *
+     * @return a reference to the domain.
+     */
+    const Domain & domain() const
+    {
+        return myDomain;
+    }
+
+    /////////////////// API //////////////////
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const
+    {
+      return myDomain.isValid();
+    }
+
+    /**
+     * Returns a pointer of an OutputImage created with the Domain aDomain.
+     *
+     * @param aDomain the domain.
+     *
+     * @return an ImagePtr.
+     */
+    OutputImage * requestImage(const Domain &aDomain)
+    {
+      return new OutputImage( Reader::importVol( myFilename, aDomain, myFunctor ) );
+    }
+
+    /**
+     * Flush (i.e. write/synchronize) an OutputImage. Does nothing
+     * since the factory is read-only.
+     *
+     * @param outputImage the OutputImage.
+     */
+    void flushImage(OutputImage* outputImage)
+    {
+      boost::ignore_unused_variable_warning( outputImage );
+    }
+
+    /**
+     * Free (i.e. delete) an OutputImage.
+     *
+     * @param outputImage the OutputImage.
+     */
+    void detachImage(OutputImage* outputImage)
+    {
+      delete outputImage;
+    }
+
+    // ------------------------- Private Datas --------------------------------
+  protected:
+
+    /// The Vol filename
+    std::string myFilename;
+
+    /// The functor used to cast the Vol values
+    Functor myFunctor;
+
+    /// The domain of the image stored in the file
+    Domain myDomain;
+
+  }; // end of class ImageFactoryFromVol
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'ImageFactoryFromVol'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'ImageFactoryFromVol' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TImageContainer, typename TFunctor>
+  std::ostream&
+  operator<< ( std::ostream & out, const ImageFactoryFromVol<TImageContainer, TFunctor> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/images/ImageFactoryFromVol.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined ImageFactoryFromVol_h
+
+#undef ImageFactoryFromVol_RECURSES
+#endif // else defined(ImageFactoryFromVol_RECURSES)
@@ -56,6 +56,7 @@
 #include "DGtal/images/CImage.h"
 #include "DGtal/base/CQuantity.h"
 #include "DGtal/images/ImageContainerBySTLMap.h"
+#include "DGtal/images/ImageContainerBySTLVector.h"
 #include "DGtal/images/SetValueIterator.h"
 #include "DGtal/kernel/sets/DigitalSetFromMap.h"
 #include "DGtal/kernel/sets/CDigitalSet.h"
@@ -77,13 +78,19 @@ namespace DGtal
    * @param ite end iterator on points
    * @param ito output iterator on points
    * @param aPred any predicate
+   * @param aParallel when 'true' and DGtal is built with OpenMP, a
+   * large random access range is filtered by several threads, so that
+   * @a aPred must then be safe to call concurrently (default: false).
+   *
+   * @note The points are output in the order of the range.
    *
    * @tparam I any model of input iterator
    * @tparam O any model of output iterator
    * @tparam P any model of concepts::CPointPredicate
    */
   template<typename I, typename O, typename P>
-  void setFromPointsRangeAndPredicate(const I& itb, const I& ite, const O& ito, const P& aPred); 
+  void setFromPointsRangeAndPredicate(const I& itb, const I& ite, const O& ito, const P& aPred,
+				      bool aParallel = false); 
 
   /**
    * Fill a set through the inserter @a ito
@@ -118,6 +125,10 @@ namespace DGtal
    * @param ito set inserter
    * @param aThreshold any value (default: 0)
    *
+   * @note An ImageContainerBySTLVector is scanned directly in its
+   * storage, by chunks of rows processed in parallel when DGtal is
+   * built with OpenMP. The points are output in the domain order.
+   *
    * @tparam I any model of CConstImage
    * @tparam O any model of output iterator
    */
@@ -138,6 +149,8 @@ namespace DGtal
    * @param low lower value
    * @param up upper value
    *
+   * @note see setFromImage(const I&, const O&, const typename I::Value&)
+   *
    * @tparam I any model of CConstImage
    * @tparam O any model of output iterator
    */
@@ -185,12 +198,20 @@ namespace DGtal
    *
    * @param aImg (returned) image
    * @param aFun a unary functor
+   * @param aParallel when 'true' and DGtal is built with OpenMP, an
+   * ImageContainerBySTLVector is filled by chunks of rows processed in
+   * parallel, each thread calling its own copy of @a aFun. Copies of
+   * @a aFun must then not share mutable state (as cached images like
+   * TiledImage do). Default: false.
+   *
+   * @note An ImageContainerBySTLVector is filled directly in its
+   * storage.
    *
    * @tparam I any model of CImage
    * @tparam F any model of CPointFunctor
    */
   template<typename I, typename F>
-  void imageFromFunctor(I& aImg, const F& aFun); 
+  void imageFromFunctor(I& aImg, const F& aFun, bool aParallel = false); 
 
   /**
    * Copy the values of @a aImg2 into @a aImg1 .
@@ -198,6 +219,10 @@ namespace DGtal
    * @param aImg1 the image to fill
    * @param aImg2 the image to copy
    *
+   * @note Between two ImageContainerBySTLVector, the values are
+   * copied directly from storage to storage, by chunks processed
+   * in parallel when DGtal is built with OpenMP.
+   *
    * @tparam I1 any model of CImage
    * @tparam I2 any model of CConstImage
    */
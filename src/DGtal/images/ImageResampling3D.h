@@ -0,0 +1,480 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file ImageResampling3D.h
+ *
+ * @author DGtal development team (\c dgtal-devel@lists.gforge.liris.cnrs.fr )
+ *
+ * @date 2026/10/19
+ *
+ * Header file for module ImageResampling3D.cpp
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(ImageResampling3D_RECURSES)
+#error Recursive header files inclusion detected in ImageResampling3D.h
+#else // defined(ImageResampling3D_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define ImageResampling3D_RECURSES
+
+#if !defined ImageResampling3D_h
+/** Prevents repeated inclusion of headers. */
+#define ImageResampling3D_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <iostream>
+#include <limits>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "DGtal/kernel/CSpace.h"
+#include "DGtal/kernel/domains/HyperRectDomain.h"
+#include "DGtal/math/linalg/SimpleMatrix.h"
+#include "DGtal/images/CConstImage.h"
+#include "DGtal/images/CImage.h"
+#include "DGtal/images/ImageContainerBySTLVector.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+  namespace detail
+  {
+    /**
+     * Read access to the values of a 3D image for
+     * ImageResampling3D, given the coordinates of a point. Generic
+     * version, through the operator() of the image, which is not
+     * assumed to be thread-safe (e.g. TiledImage or ImageCache
+     * update their cache when read).
+     *
+     * @tparam TImage a model of CConstImage on a 3D HyperRectDomain.
+     */
+    template <typename TImage>
+    struct ResamplingSource
+    {
+      typedef typename TImage::Value Value;
+      typedef typename TImage::Point Point;
+      typedef typename Point::Coordinate Coordinate;
+      /// 'true' iff the image may be read concurrently.
+      static const bool threadSafe = false;
+
+      ResamplingSource( const TImage & anImage, const Value & anOutsideValue )
+        : myImage( anImage ),
+          myLower( anImage.domain().lowerBound() ),
+          myUpper( anImage.domain().upperBound() ),
+          myOutsideValue( anOutsideValue )
+      {}
+
+      /// @return 'true' iff the cell of corners (x,y,z) and
+      /// (x+s,y+s,z+s) is in the domain.
+      bool isInside( Coordinate x, Coordinate y, Coordinate z, Coordinate s ) const
+      {
+        return x >= myLower[ 0 ] && y >= myLower[ 1 ] && z >= myLower[ 2 ]
+          && x + s <= myUpper[ 0 ] && y + s <= myUpper[ 1 ] && z + s <= myUpper[ 2 ];
+      }
+
+      /// @return the value at (x,y,z), which must be in the domain.
+      Value at( Coordinate x, Coordinate y, Coordinate z ) const
+      {
+        return myImage( Point( x, y, z ) );
+      }
+
+      /// @return the value at (x,y,z), or the outside value.
+      Value operator()( Coordinate x, Coordinate y, Coordinate z ) const
+      {
+        return isInside( x, y, z, 0 ) ? at( x, y, z ) : myOutsideValue;
+      }
+
+      /// Gets the 8 values of the unit cell of lowest corner (x,y,z),
+      /// which must be in the domain, x varying first.
+      void cell( Coordinate x, Coordinate y, Coordinate z, double v[ 8 ] ) const
+      {
+        for ( int k = 0; k < 8; ++k )
+          v[ k ] = static_cast<double>( at( x + ( k & 1 ), y + ( ( k >> 1 ) & 1 ), z + ( k >> 2 ) ) );
+      }
+
+      const TImage & myImage;
+      Point myLower;
+      Point myUpper;
+      Value myOutsideValue;
+    };
+
+    /**
+     * Specialization for images stored in a vector, read directly
+     * in their storage.
+     */
+    template <typename TDomain, typename TValue>
+    struct ResamplingSource< ImageContainerBySTLVector<TDomain, TValue> >
+    {
+      typedef ImageContainerBySTLVector<TDomain, TValue> Image;
+      typedef TValue Value;
+      typedef typename Image::Point Point;
+      typedef typename Point::Coordinate Coordinate;
+      static const bool threadSafe = true;
+
+      ResamplingSource( const Image & anImage, const Value & anOutsideValue )
+        : myData( anImage.empty() ? 0 : &anImage[ 0 ] ),
+          myLower( anImage.domain().lowerBound() ),
+          myUpper( anImage.domain().upperBound() ),
+          myOutsideValue( anOutsideValue )
+      {
+        myStrideY = myUpper[ 0 ] - myLower[ 0 ] + 1;
+        myStrideZ = myStrideY * ( myUpper[ 1 ] - myLower[ 1 ] + 1 );
+      }
+
+      bool isInside( Coordinate x, Coordinate y, Coordinate z, Coordinate s ) const
+      {
+        return x >= myLower[ 0 ] && y >= myLower[ 1 ] && z >= myLower[ 2 ]
+          && x + s <= myUpper[ 0 ] && y + s <= myUpper[ 1 ] && z + s <= myUpper[ 2 ];
+      }
+
+      std::ptrdiff_t offset( Coordinate x, Coordinate y, Coordinate z ) const
+      {
+        return ( x - myLower[ 0 ] ) + ( y - myLower[ 1 ] ) * myStrideY
+          + ( z - myLower[ 2 ] ) * myStrideZ;
+      }
+
+      Value at( Coordinate x, Coordinate y, Coordinate z ) const
+      {
+        return myData[ offset( x, y, z ) ];
+      }
+
+      Value operator()( Coordinate x, Coordinate y, Coordinate z ) const
+      {
+        return isInside( x, y, z, 0 ) ? at( x, y, z ) : myOutsideValue;
+      }
+
+      void cell( Coordinate x, Coordinate y, Coordinate z, double v[ 8 ] ) const
+      {
+        const Value* p = myData + offset( x, y, z );
+        v[ 0 ] = static_cast<double>( p[ 0 ] );
+        v[ 1 ] = static_cast<double>( p[ 1 ] );
+        v[ 2 ] = static_cast<double>( p[ myStrideY ] );
+        v[ 3 ] = static_cast<double>( p[ myStrideY + 1 ] );
+        p += myStrideZ;
+        v[ 4 ] = static_cast<double>( p[ 0 ] );
+        v[ 5 ] = static_cast<double>( p[ 1 ] );
+        v[ 6 ] = static_cast<double>( p[ myStrideY ] );
+        v[ 7 ] = static_cast<double>( p[ myStrideY + 1 ] );
+      }
+
+      const Value* myData;
+      Point myLower;
+      Point myUpper;
+      Value myOutsideValue;
+      std::ptrdiff_t myStrideY;
+      std::ptrdiff_t myStrideZ;
+    };
+
+    /**
+     * Write access to the rows of a 3D image for ImageResampling3D.
+     * Generic version, through the setValue() of the image, which is
+     * not assumed to be thread-safe.
+     *
+     * @tparam TImage a model of CImage on a 3D HyperRectDomain.
+     */
+    template <typename TImage>
+    struct ResamplingTarget
+    {
+      typedef typename TImage::Value Value;
+      typedef typename TImage::Point Point;
+      typedef typename Point::Coordinate Coordinate;
+      /// 'true' iff distinct rows may be written concurrently.
+      static const bool threadSafe = false;
+
+      ResamplingTarget( TImage & anImage ) : myImage( anImage ) {}
+
+      void writeRow( Coordinate x0, Coordinate y, Coordinate z,
+                     const std::vector<Value> & aRow )
+      {
+        for ( std::size_t i = 0; i < aRow.size(); ++i )
+          myImage.setValue( Point( x0 + static_cast<Coordinate>( i ), y, z ), aRow[ i ] );
+      }
+
+      TImage & myImage;
+    };
+
+    /**
+     * Specialization for images stored in a vector, written directly
+     * in their storage.
+     */
+    template <typename TDomain, typename TValue>
+    struct ResamplingTarget< ImageContainerBySTLVector<TDomain, TValue> >
+    {
+      typedef ImageContainerBySTLVector<TDomain, TValue> Image;
+      typedef TValue Value;
+      typedef typename Image::Point Point;
+      typedef typename Point::Coordinate Coordinate;
+      static const bool threadSafe = true;
+
+      ResamplingTarget( Image & anImage ) : myImage( anImage ) {}
+
+      void writeRow( Coordinate x0, Coordinate y, Coordinate z,
+                     const std::vector<Value> & aRow )
+      {
+        std::copy( aRow.begin(), aRow.end(),
+                   myImage.begin() + myImage.linearized( Point( x0, y, z ) ) );
+      }
+
+      Image & myImage;
+    };
+
+    /**
+     * Floor of a real number, without call to the math library so
+     * that the loops using it can be vectorized.
+     * @param x any real number in the range of the integers.
+     * @return the greatest integer not greater than x.
+     */
+    inline
+    std::int64_t resamplingFloor( double x )
+    {
+      const std::int64_t i = static_cast<std::int64_t>( x );
+      return i - ( x < static_cast<double>( i ) ? 1 : 0 );
+    }
+
+    /**
+     * @param aSource a ResamplingSource.
+     * @param x,y,z the coordinates of any real point.
+     * @param x0,y0,z0 the floors of x, y and z.
+     * @return the trilinear interpolation of the values of the source
+     * at this point.
+     */
+    template <typename TSource>
+    inline
+    double trilinearValue( const TSource & aSource, double x, double y, double z,
+                           std::int64_t x0, std::int64_t y0, std::int64_t z0 )
+    {
+      typedef typename TSource::Coordinate Coordinate;
+      const Coordinate cx = static_cast<Coordinate>( x0 );
+      const Coordinate cy = static_cast<Coordinate>( y0 );
+      const Coordinate cz = static_cast<Coordinate>( z0 );
+      double v[ 8 ];
+      if ( aSource.isInside( cx, cy, cz, 1 ) )
+        aSource.cell( cx, cy, cz, v );
+      else // near or outside the border of the domain.
+        for ( int k = 0; k < 8; ++k )
+          v[ k ] = static_cast<double>( aSource( cx + ( k & 1 ), cy + ( ( k >> 1 ) & 1 ),
+                                                 cz + ( k >> 2 ) ) );
+      const double dx = x - static_cast<double>( x0 );
+      const double dy = y - static_cast<double>( y0 );
+      const double dz = z - static_cast<double>( z0 );
+      const double v00 = v[ 0 ] + dx * ( v[ 1 ] - v[ 0 ] );
+      const double v10 = v[ 2 ] + dx * ( v[ 3 ] - v[ 2 ] );
+      const double v01 = v[ 4 ] + dx * ( v[ 5 ] - v[ 4 ] );
+      const double v11 = v[ 6 ] + dx * ( v[ 7 ] - v[ 6 ] );
+      const double v0 = v00 + dy * ( v10 - v00 );
+      const double v1 = v01 + dy * ( v11 - v01 );
+      return v0 + dz * ( v1 - v0 );
+    }
+
+    /**
+     * @param aValue any real value.
+     * @return this value converted to TValue, rounded to the nearest
+     * integer if TValue is an integer type.
+     */
+    template <typename TValue>
+    inline
+    TValue resamplingCast( double aValue )
+    {
+      return std::numeric_limits<TValue>::is_integer
+        ? static_cast<TValue>( std::floor( aValue + 0.5 ) )
+        : static_cast<TValue>( aValue );
+    }
+  } // namespace detail
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class ImageResampling3D
+  /**
+   * Description of template class 'ImageResampling3D' <p>
+   * \brief Aim: Resamples a whole 3D image through a backward affine
+   * transformation, e.g. a rigid transformation, with nearest
+   * neighbor or trilinear interpolation.
+   *
+   * The transformation maps each point \a p of the output image to
+   * the real point \f$ A p + t \f$ of the input image, where \a A is
+   * a 3x3 matrix and \a t a vector. The rigid transformations are
+   * given as for functors::BackwardRigidTransformation3D, so that
+   * resampling with nearest neighbor interpolation gives the same
+   * image as a ConstImageAdapter with this functor, except where a
+   * preimage coordinate is halfway between two integers (such ties
+   * are rounded upward here, and the floating-point operations are
+   * not the same).
+   *
+   * Instead of evaluating the transformation at each point, the
+   * output domain is traversed row by row: the preimages of the
+   * points of a row are obtained from the preimage of its first point
+   * by adding multiples of the first column of \a A. The coordinates
+   * of a row are computed in a separate loop, free of dependencies,
+   * which the compiler vectorizes, before the values are fetched in
+   * the input image. Images stored in a vector
+   * (ImageContainerBySTLVector) are read and written directly in
+   * their storage; other images are accessed through their
+   * operator() and setValue(). The rows are distributed among
+   * threads when OpenMP is enabled and the input image is stored in
+   * a vector, the writes being serialized for other output images;
+   * other input images (whose reads may update a cache) are
+   * resampled by a single thread.
+   *
+   * The points whose preimage is outside the input domain get a given
+   * outside value. With trilinear interpolation, the neighbors that
+   * are outside the input domain count as the outside value, and
+   * interpolated values are rounded when the output value type is an
+   * integer.
+   *
+   * @code
+   typedef ImageResampling3D< Z3i::Space > Resampling;
+   // same transformation as BackwardRigidTransformation3D
+   Resampling resampling( RealPoint( 5, 5, 5 ), RealVector( 1, 0, 1 ),
+                          M_PI_4, RealVector( 3, -3, 3 ) );
+   Image output( outputDomain );
+   resampling.resample( input, output, Resampling::TRILINEAR );
+   * @endcode
+   *
+   * @tparam TSpace a 3 dimensional space.
+   *
+   * @see testImageResampling3D.cpp
+   */
+  template <typename TSpace>
+  class ImageResampling3D
+  {
+    BOOST_CONCEPT_ASSERT(( concepts::CSpace<TSpace> ));
+    BOOST_STATIC_ASSERT(( TSpace::dimension == 3 ));
+
+    // ----------------------- Types ------------------------------
+  public:
+    typedef TSpace Space;
+    typedef typename Space::Point Point;
+    typedef typename Space::RealPoint RealPoint;
+    typedef typename Space::RealVector RealVector;
+    typedef SimpleMatrix<double, 3, 3> Matrix;
+
+    /// The interpolation of the values of the input image.
+    enum Interpolation { NEAREST, TRILINEAR };
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+     * Constructor. The identity transformation.
+     */
+    ImageResampling3D();
+
+    /**
+     * Constructor from an affine transformation.
+     * @param aMatrix the linear part \a A.
+     * @param aTranslation the translation \a t.
+     */
+    ImageResampling3D( const Matrix & aMatrix, const RealVector & aTranslation );
+
+    /**
+     * Constructor from a rigid transformation, with the same
+     * parameters as functors::BackwardRigidTransformation3D.
+     * @param aOrigin the center of rotation.
+     * @param aAxis the axis of rotation.
+     * @param angle the angle given in radians.
+     * @param aTranslate the translation.
+     */
+    ImageResampling3D( const RealPoint & aOrigin, const RealVector & aAxis,
+                       double angle, const RealVector & aTranslate );
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /// @return the linear part \a A of the transformation.
+    const Matrix & matrix() const;
+
+    /// @return the translation \a t of the transformation.
+    const RealVector & translation() const;
+
+    /**
+     * @param aPoint any point of the output image.
+     * @return its preimage \f$ A p + t \f$ in the input image.
+     */
+    RealPoint operator()( const Point & aPoint ) const;
+
+    /**
+     * Resamples the input image on the domain of the output image.
+     *
+     * @param anInput the input image (model of CConstImage on a 3D
+     * HyperRectDomain).
+     * @param anOutput (modified) the output image (model of CImage on
+     * a 3D HyperRectDomain), whose values are all set.
+     * @param anInterpolation the interpolation of the input values.
+     * @param anOutsideValue the value of the points whose preimage is
+     * outside of the input domain.
+     *
+     * @tparam TInputImage the type of the input image.
+     * @tparam TOutputImage the type of the output image, whose values
+     * are converted from the input values.
+     */
+    template <typename TInputImage, typename TOutputImage>
+    void resample( const TInputImage & anInput, TOutputImage & anOutput,
+                   Interpolation anInterpolation = NEAREST,
+                   typename TInputImage::Value anOutsideValue
+                   = typename TInputImage::Value() ) const;
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+    /// The linear part of the transformation.
+    Matrix myMatrix;
+    /// The translation of the transformation.
+    RealVector myTranslation;
+
+  }; // end of class ImageResampling3D
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'ImageResampling3D'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'ImageResampling3D' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TSpace>
+  std::ostream&
+  operator<< ( std::ostream & out, const ImageResampling3D<TSpace> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/images/ImageResampling3D.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined ImageResampling3D_h
+
+#undef ImageResampling3D_RECURSES
+#endif // else defined(ImageResampling3D_RECURSES)
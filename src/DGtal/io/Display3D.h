@@ -204,6 +204,112 @@ namespace DGtal
       double nx, ny, nz;
     };
 
+    /**
+     * The graphical structure that stores a whole group of cubes
+     * sharing the same "OpenGL name" (see addCubes). Centers are
+     * stored as three arrays of floats (structure of arrays). Colors
+     * and widths are only stored per cube once they differ within the
+     * group, otherwise the common values @a color and @a width are
+     * used. A cube needs 12 bytes instead of about 48 for a CubeD3D.
+     *
+     * @see Display3D, Viewer3D, Board3D, Board3DTo2D
+     */
+    struct CubeInstancesD3D {
+      std::vector<float> x, y, z;        ///< Cube centers.
+      std::vector<DGtal::Color> colors;  ///< Per cube colors, or empty.
+      std::vector<float> widths;         ///< Per cube widths, or empty.
+      DGtal::Color color;                ///< Color shared by all cubes if colors is empty.
+      double width = 0.5;                ///< Width shared by all cubes if widths is empty (distance from center to faces).
+
+      /// @return the number of cubes in the group.
+      std::size_t size() const
+      { return x.size(); }
+
+      /// @param i the index of a cube.
+      /// @return its center.
+      RealPoint cubeCenter( std::size_t i ) const
+      { return RealPoint( x[ i ], y[ i ], z[ i ] ); }
+
+      /// @param i the index of a cube.
+      /// @return its color.
+      const DGtal::Color & cubeColor( std::size_t i ) const
+      { return colors.empty() ? color : colors[ i ]; }
+
+      /// @param i the index of a cube.
+      /// @return its width (distance from its center to its faces).
+      double cubeWidth( std::size_t i ) const
+      { return widths.empty() ? width : widths[ i ]; }
+
+      /**
+       * Reserves memory for @a n more cubes.
+       * @param n a number of cubes.
+       */
+      void reserveMore( std::size_t n );
+
+      /**
+       * Adds a cube to the group.
+       * @param center the cube center.
+       * @param aColor its color.
+       * @param aWidth its width (distance from its center to its faces).
+       */
+      void push_back( const RealPoint & center,
+                      const DGtal::Color & aColor, double aWidth );
+
+      /**
+       * Reorders the cubes by decreasing distance to a point (the
+       * camera position), so that transparent cubes are drawn from
+       * back to front.
+       * @param p the point.
+       */
+      void sortFarthestFirst( const RealPoint & p );
+    };
+
+    /**
+     * The graphical structure that stores a group of signed surfels
+     * displayed as prisms (see addSurfels) with the color and "OpenGL
+     * name" of the group. Only the base quad centers (three arrays of
+     * floats) and one orientation byte are stored per surfel, the six
+     * faces of its prism are computed by prismFaces when the group is
+     * drawn or exported. A surfel thus needs 13 bytes instead of the
+     * six QuadD3D (768 bytes) added by addPrism.
+     *
+     * @see Display3D, Viewer3D, Board3D, Board3DTo2D
+     */
+    struct SurfelInstancesD3D : public CommonD3D {
+      std::vector<float> x, y, z;               ///< Base quad centers.
+      std::vector<unsigned char> orientations;  ///< Orthogonal axis (bits 0-1) and sign (bit 2) of each surfel.
+      double shiftFactor = 1.0;                 ///< Sum of the size shift factor and of the prism shift (see addPrism).
+
+      /// @return the number of surfels in the group.
+      std::size_t size() const
+      { return x.size(); }
+
+      /**
+       * Adds a surfel to the group.
+       * @param baseQuadCenter the center of its base quad.
+       * @param orthDir the axis orthogonal to the surfel.
+       * @param aSign its sign (true when oriented in the direct axis orientation).
+       */
+      void push_back( const RealPoint & baseQuadCenter,
+                      Dimension orthDir, bool aSign );
+
+      /**
+       * Computes the six faces of the prism of a surfel (with the
+       * color and name of the group).
+       * @param i the index of a surfel.
+       * @param[out] faces the up face, the down face and the four small faces.
+       */
+      void prismFaces( std::size_t i, QuadD3D faces[ 6 ] ) const;
+
+      /**
+       * Reorders the surfels by decreasing distance to a point (the
+       * camera position), so that transparent prisms are drawn from
+       * back to front.
+       * @param p the point.
+       */
+      void sortFarthestFirst( const RealPoint & p );
+    };
+
 
   public:
 
@@ -256,6 +362,12 @@ namespace DGtal
     /// The type that maps identifier name -> vector of CubeD3D.
     typedef std::map<DGtal::int32_t, std::vector< CubeD3D > > CubesMap;
 
+    /// The type that maps identifier name -> group of cubes CubeInstancesD3D.
+    typedef std::map<DGtal::int32_t, CubeInstancesD3D > CubeInstancesMap;
+
+    /// The type that stores the groups of surfels SurfelInstancesD3D.
+    typedef std::vector< SurfelInstancesD3D > SurfelInstancesList;
+
 
   protected:
     /// The Khalimsky space
@@ -626,6 +738,39 @@ namespace DGtal
     void addCube(const RealPoint &center, double width=1.0);
 
 
+    /**
+     * Method to add the cubes centered on the (embedded) digital
+     * points of the range [@a itb, @a ite), with the current fill
+     * color and "OpenGL name". This is equivalent to a call to addCube
+     * per point but the cubes are stored in the compact group
+     * myCubeInstancesMap[ name3d() ] and the bounding box is updated
+     * once, which makes it suitable for millions of voxels.
+     *
+     * @tparam TPointIterator any model of input iterator on digital points.
+     * @param itb begin iterator on points.
+     * @param ite end iterator on points.
+     * @param width the cube width.
+     */
+    template <typename TPointIterator>
+    void addCubes( TPointIterator itb, TPointIterator ite, double width=1.0 );
+
+    /**
+     * Same as addCubes, except that the color of the cube centered on
+     * a point p is given by @a colorFct( p ) (for instance a colormap
+     * applied to the value of an image at p).
+     *
+     * @tparam TPointIterator any model of input iterator on digital points.
+     * @tparam TColorFunctor a functor from digital points to DGtal::Color.
+     * @param itb begin iterator on points.
+     * @param ite end iterator on points.
+     * @param colorFct the functor giving the color of each point.
+     * @param width the cube width.
+     */
+    template <typename TPointIterator, typename TColorFunctor>
+    void addColoredCubes( TPointIterator itb, TPointIterator ite,
+                          const TColorFunctor & colorFct, double width=1.0 );
+
+
     /**
      * Method to add a point to the current display.
      * @param center ball center x
@@ -656,6 +801,23 @@ namespace DGtal
                         bool xSurfel, bool ySurfel, bool zSurfel, double sizeShiftFactor,
                         double sizeFactor=1.0, bool isSigned= false, bool aSign=true);
 
+    /**
+     * Method to add the signed surfels of the range [@a itb, @a ite)
+     * as prisms, with the current fill color and "OpenGL name". This
+     * is equivalent to a call to addPrism per surfel (signed display,
+     * @a sizeFactor = 1) but the surfels are stored in one compact
+     * group of mySurfelInstancesList and the bounding box is updated
+     * once, which makes it suitable for large digital surfaces.
+     *
+     * @tparam TSCellIterator any model of input iterator on signed surfels.
+     * @param itb begin iterator on surfels.
+     * @param ite end iterator on surfels.
+     * @param sizeShiftFactor set the distance between the display of the surfels and potential Cube.
+     */
+    template <typename TSCellIterator>
+    void addSurfels( TSCellIterator itb, TSCellIterator ite,
+                     double sizeShiftFactor=1.0 );
+
 
 
     /**
@@ -856,6 +1018,14 @@ namespace DGtal
     /// integer identifier (OpenGL name)
     CubesMap myCubesMap;
 
+    /// Represents all the cubes added by groups (see addCubes). The
+    /// map int --> CubeInstancesD3D associates a group of cubes to an
+    /// integer identifier (OpenGL name)
+    CubeInstancesMap myCubeInstancesMap;
+
+    /// Represents all the surfels added by groups (see addSurfels).
+    SurfelInstancesList mySurfelInstancesList;
+
 
     /// names of the lists in myCubeSetList
     ///
@@ -917,6 +1087,36 @@ namespace DGtal
      */
     static void normalize (double vec[3]);
 
+    /**
+     * Computes the six faces of the prism displaying a surfel (used
+     * by addPrism and SurfelInstancesD3D), without color nor name.
+     * @param baseQuadCenter  base quad center point
+     * @param xSurfel true if the surfel has its main face in the direction of the x-axis
+     * @param ySurfel true if the surfel has its main face in the direction of the y-axis
+     * @param zSurfel true if the surfel has its main face in the direction of the z-axis
+     * @param shiftFactor the sum of the size shift factor and of the prism shift.
+     * @param sizeFactor set the difference between the upper face of the prism and the down face
+     * @param isSigned to specify if we want to display an signed or unsigned Cell.
+     * @param aSign the sign of the cell (used if @a isSigned is true).
+     * @param[out] faces the up face, the down face and the four small faces.
+     */
+    static void prismFaces( const RealPoint & baseQuadCenter,
+                            bool xSurfel, bool ySurfel, bool zSurfel,
+                            double shiftFactor, double sizeFactor,
+                            bool isSigned, bool aSign, QuadD3D faces[ 6 ] );
+
+    /**
+     * Adds a cube to a mesh (used by exportToMesh).
+     * @param aMesh the mesh.
+     * @param center the cube center.
+     * @param width the distance between the center and the faces.
+     * @param color the cube color.
+     * @param vertexIndex (modified) the index of the next vertex of @a aMesh.
+     */
+    static void addCubeToMesh( Mesh<RealPoint> & aMesh, const RealPoint & center,
+                               double width, const DGtal::Color & color,
+                               unsigned int & vertexIndex );
+
 
   }; // end of class Display3D
 
@@ -579,6 +579,8 @@ namespace DGtal
     // SCellsRange
     /**
      * @brief draw
+     * A range made only of surfels (and not drawn in mode "Basic") is
+     * added as one compact group of prisms (see Display3D::addSurfels).
      * @param display the display where to draw
      * @param anObject the object to draw
      */
@@ -253,7 +253,7 @@ namespace DGtal
         DGtal::IOException dgtalio;
         const std::string extension = filename.substr(filename.find_last_of(".") + 1);
 
-        if ( extension == "vol" )
+        if ( extension == "vol" || extension == "cvol" )
           {
             return VolReader<TContainer, TFunctor>::importVol( filename, aFunctor );
           }
@@ -41,6 +41,8 @@
 //////////////////////////////////////////////////////////////////////////////
 // Inclusions
 #include <iostream>
+#include <string>
+#include <vector>
 #include <DGtal/kernel/SpaceND.h>
 #include "DGtal/base/Common.h"
 #include "DGtal/shapes/Mesh.h"
@@ -57,8 +59,18 @@ namespace DGtal
 /**
  * Description of class 'MeshReader' <p> 
  * \brief Aim: Defined to import
- * OFF and OFS surface mesh. It allows to import a Mesh object and takes
+ * OFF, OFS, OBJ and PLY surface mesh. It allows to import a Mesh object and takes
  * into accouts the optional color faces.
+ *
+ * OFF, OBJ and PLY files are loaded in memory at once and parsed
+ * with hand-written number parsers. When OpenMP is enabled, large
+ * files are cut into line-aligned blocks which are parsed in
+ * parallel. OFF records spanning several lines are still accepted
+ * (they are then parsed sequentially). Binary PLY files (little or big endian) are decoded
+ * without any text conversion. A TriangulatedSurface or a
+ * PolygonalSurface is obtained from the imported mesh with
+ * MeshHelpers::mesh2TriangulatedSurface or
+ * MeshHelpers::mesh2PolygonalSurface.
  * 
  * The importation can be done automatically according the input file
  * extension with the operator << 
@@ -127,6 +139,157 @@ public:
   static  bool  importOFSFile(const std::string & filename, 
 			      DGtal::Mesh<TPoint> & aMesh, bool invertVertexOrder=false, double scale=1.0);
   
+
+ /** 
+  * Main method to import OBJ meshes file (Wavefront format). Only
+  * vertices ("v") and faces ("f") are read, texture and normal
+  * indices of faces are ignored. Negative (relative) indices are
+  * supported.
+  * 
+  * @param filename the file name to import.
+  * @param aMesh (return) the mesh object to be imported.
+  * @param invertVertexOrder used to invert (default value=false) the order of imported points (important for normal orientation). 
+  * @return 'true' if the import was successful.
+  */
+  
+  static  bool  importOBJFile(const std::string & filename, 
+			      DGtal::Mesh<TPoint> & aMesh, bool invertVertexOrder=false);
+
+
+ /** 
+  * Main method to import PLY meshes file (Polygon File Format), in
+  * ascii, binary little endian or binary big endian encoding. The
+  * coordinates are read from the "x", "y" and "z" properties of the
+  * "vertex" element and the faces from the "vertex_indices" (or
+  * "vertex_index") list of the "face" element. The optional face
+  * colors are read from its "red", "green", "blue" and "alpha"
+  * properties. Other elements and properties are skipped.
+  * 
+  * @param filename the file name to import.
+  * @param aMesh (return) the mesh object to be imported.
+  * @param invertVertexOrder used to invert (default value=false) the order of imported points (important for normal orientation). 
+  * @return 'true' if the import was successful.
+  */
+  
+  static  bool  importPLYFile(const std::string & filename, 
+			      DGtal::Mesh<TPoint> & aMesh, bool invertVertexOrder=false);
+
+  
+  // ------------------------- Internals ------------------------------------
+private:
+
+  /// Faces parsed from a block of lines, stored contiguously.
+  struct FaceBlock
+  {
+    /// The number of vertices of each face.
+    std::vector<unsigned int> sizes;
+    /// The vertex indices of all the faces.
+    std::vector<unsigned int> indices;
+    /// For each face, '1' if a color was given, '0' otherwise.
+    std::vector<char> hasColor;
+    /// The colors of the faces (meaningful when hasColor is '1').
+    std::vector<DGtal::Color> colors;
+  };
+
+  /**
+   * Reads the whole content of a file in memory. A null character is
+   * appended so that parsers always find a delimiter.
+   *
+   * @param filename the file name to read.
+   * @param buffer (return) the file content.
+   * @return 'true' if the file was read.
+   */
+  static bool readFile( const std::string & filename, std::vector<char> & buffer );
+
+  /**
+   * Cuts the range [begin,end) in blocks of whole lines, one per
+   * OpenMP thread (a single block when OpenMP is disabled or when the
+   * range is small).
+   *
+   * @param begin the beginning of the text.
+   * @param end the end of the text.
+   * @return the block boundaries (first is \a begin, last is \a end).
+   */
+  static std::vector<const char*> lineBlocks( const char* begin, const char* end );
+
+  /**
+   * Parses an unsigned integer.
+   * @param p (in/out) the current position, moved after the number.
+   * @param value (return) the parsed value.
+   * @return 'false' if there was no number at \a p.
+   */
+  static bool parseUnsigned( const char* & p, unsigned int & value );
+
+  /**
+   * Parses a signed integer.
+   * @param p (in/out) the current position, moved after the number.
+   * @param value (return) the parsed value.
+   * @return 'false' if there was no number at \a p.
+   */
+  static bool parseInteger( const char* & p, long & value );
+
+  /**
+   * Parses a floating point number. Common decimal values are
+   * converted exactly without calling the C library, the others are
+   * delegated to strtod.
+   *
+   * @param p (in/out) the current position, moved after the number.
+   * @param value (return) the parsed value.
+   * @return 'false' if there was no number at \a p.
+   */
+  static bool parseDouble( const char* & p, double & value );
+
+  /**
+   * Reads a value of a PLY element.
+   *
+   * @param p (in/out) the current position, moved after the value.
+   * @param end the end of the data.
+   * @param type the PLY type code of the value.
+   * @param format 0 for ascii, 1 for binary little endian, 2 for binary big endian.
+   * @param value (return) the value.
+   * @return 'false' if no value could be read.
+   */
+  static bool readPLYValue( const char* & p, const char* end, int type, int format,
+                            double & value );
+
+  /**
+   * Parses the optional color (r g b [a] in [0,1]) ending a face
+   * record of an OFF file and appends it to a block.
+   *
+   * @param p the position after the vertex indices of the face.
+   * @param eol the end of the line of the face.
+   * @param block (in/out) the block of the face.
+   */
+  static void parseOFFFaceColor( const char* p, const char* eol, FaceBlock & block );
+
+  /**
+   * Parses the vertices and faces of an OFF file token by token, a
+   * record being allowed to span several lines (a vertex ends after
+   * its third coordinate, a face after its last index, the rest of
+   * the line being ignored or read as the face color). This is the
+   * sequential fallback of the line-aligned parallel parser.
+   *
+   * @param p the beginning of the records.
+   * @param end the end of the text.
+   * @param vertices (in/out) the vertices to read (already sized).
+   * @param nbFaces the number of faces to read.
+   * @param faces (return) the faces.
+   * @return 'true' if all the records were read.
+   */
+  static bool parseOFFTokens( const char* p, const char* end,
+                              std::vector<TPoint> & vertices,
+                              unsigned int nbFaces, FaceBlock & faces );
+
+  /**
+   * Appends the faces of the given blocks to a mesh.
+   *
+   * @param blocks the parsed faces.
+   * @param aMesh (in/out) the mesh to fill.
+   * @param invertVertexOrder when 'true', the faces are reversed.
+   */
+  static void addFaces( const std::vector<FaceBlock> & blocks,
+                        DGtal::Mesh<TPoint> & aMesh, bool invertVertexOrder );
+
   
   
 
@@ -63,6 +63,12 @@ namespace DGtal
    * The private methods have been backported from the SimpleVol project 
    * (see http://liris.cnrs.fr/david.coeurjolly).
    *
+   * Besides raw (Version 2) and zlib compressed (Version 3) files,
+   * chunked files (Version 4) are read. There, the volume is cut
+   * into bricks which are compressed independently, so that any
+   * subdomain can be imported by reading only the bricks it
+   * intersects (see VolWriter::exportChunkedVol).
+   *
    * Example usage:
    * @code
    * ...
@@ -92,6 +98,7 @@ namespace DGtal
 
     typedef TImageContainer ImageContainer;
     typedef typename TImageContainer::Value Value;
+    typedef typename TImageContainer::Domain Domain;
     typedef TFunctor Functor;
     
     BOOST_CONCEPT_ASSERT((  concepts::CUnaryFunctor<TFunctor, unsigned char, Value > )) ;    
@@ -113,6 +120,34 @@ namespace DGtal
      */
     static ImageContainer importVol(const std::string & filename, 
                                     const Functor & aFunctor =  Functor());
+
+    /**
+     * Imports the part of a Vol file lying in a given domain.
+     *
+     * For chunked files (Version 4, see VolWriter::exportChunkedVol),
+     * only the bricks intersecting @a aDomain are read and
+     * uncompressed (in parallel when DGtal is built with OpenMP).
+     * Other versions are fully read then cropped.
+     *
+     * @param filename the file name to import.
+     * @param aDomain the domain to import, which must be included in
+     * the domain of the file (see importDomain).
+     * @param aFunctor the functor used to import and cast the source
+     * image values into the type of the image container value.
+     *
+     * @return an instance of the ImageContainer, whose domain is @a aDomain.
+     */
+    static ImageContainer importVol(const std::string & filename,
+                                    const Domain & aDomain,
+                                    const Functor & aFunctor =  Functor());
+
+    /**
+     * Reads only the header of a Vol file.
+     *
+     * @param filename the file name to read.
+     * @return the domain of the image stored in the file.
+     */
+    static Domain importDomain(const std::string & filename);
     
   private:
 
@@ -166,6 +201,32 @@ namespace DGtal
     
     //! Global list of required fields in a .vol file
     static const char *requiredHeaders[];
+
+    /**
+     * Opens a Vol file and reads its header.
+     *
+     * @param filename the file name to open.
+     * @param header (returns) the header fields.
+     * @param domain (returns) the domain of the image.
+     * @param version (returns) the version of the file.
+     * @return the file, positioned at the beginning of the data.
+     */
+    static FILE * importHeader( const std::string & filename, HeaderField * header,
+                                Domain & domain, int & version );
+
+    /**
+     * Reads the bricks of a chunked Vol file (Version 4) that
+     * intersect the domain of @a image, and fills @a image.
+     *
+     * @param fin the file, positioned at the beginning of the data.
+     * @param header the header fields.
+     * @param domain the domain of the whole image stored in the file.
+     * @param image (modified) the image to fill.
+     * @param aFunctor the functor used to cast the values.
+     */
+    static void importBricks( FILE * fin, const HeaderField * header,
+                              const Domain & domain, ImageContainer & image,
+                              const Functor & aFunctor );
    
   }; // end of class VolReader
 
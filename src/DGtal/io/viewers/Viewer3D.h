@@ -1381,22 +1381,29 @@ namespace DGtal
     /**
      * Creates an OpenGL list of type GL_QUADS from a CubeD3D.  Only
      * one OpenGL list is created but each map compoment (CubeD3D
-     * vector) are marked by its identifier through the OpenGl
-     * glPushName() function.
+     * vector or group of cubes) are marked by its identifier through
+     * the OpenGl glPushName() function.
      * See @ref moduleQGLInteraction for more details.
      * @param[in] aCubeMap  a map of cube (CubesMap) associating a name to a vector of CubeD3D.
+     * @param[in] aCubeInstancesMap  a map (CubeInstancesMap) associating a name to a group of cubes.
      * @param[in] idList the Id of the list (should be given by glGenLists).
      **/
-    void glCreateListCubesMaps(const typename Display3D<Space, KSpace>::CubesMap &aCubeMap, unsigned int idList);
+    void glCreateListCubesMaps(const typename Display3D<Space, KSpace>::CubesMap &aCubeMap,
+                               const typename Display3D<Space, KSpace>::CubeInstancesMap &aCubeInstancesMap,
+                               unsigned int idList);
 
 
 
     /**
-     * Creates an OpenGL list of type GL_QUADS from a vector of QuadD3D.
+     * Creates an OpenGL list of type GL_QUADS from a vector of QuadD3D
+     * and from the prisms of groups of surfels.
      * @param[in] aVectQuad  a vector of quads (QuadD3D) containing the quads to be displayed.
+     * @param[in] aSurfelInstancesList the groups of surfels (SurfelInstancesD3D) to be displayed.
      * @param[in] idList the Id of the list (should be given by glGenLists).
      **/
-    void glCreateListQuadD3D(const VectorQuad &aVectQuad, unsigned int idList);
+    void glCreateListQuadD3D(const VectorQuad &aVectQuad,
+                             const typename Display3D<Space, KSpace>::SurfelInstancesList &aSurfelInstancesList,
+                             unsigned int idList);
 
 
     /**
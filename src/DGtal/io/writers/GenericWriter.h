@@ -107,7 +107,7 @@ namespace DGtal
 
   /**
    * GenericWriter
-   * Template partial specialisation for volume images of dimension 3 and unsigned char value type (which allows to export vol, pgm3D, h5 and raw file format).
+   * Template partial specialisation for volume images of dimension 3 and unsigned char value type (which allows to export vol, cvol (chunked vol), pgm3D, h5 and raw file format).
    **/
   template <typename TContainer, typename TFunctor>
   struct GenericWriter<TContainer, 3 , unsigned char,  TFunctor>
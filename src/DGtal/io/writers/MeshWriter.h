@@ -54,7 +54,17 @@ namespace DGtal
   // template class MeshWriter
   /**
    * Description of template struct 'MeshWriter' <p>
-   * \brief Aim: Export a Mesh (Mesh object) in different format as OFF and OBJ).
+   * \brief Aim: Export a Mesh (Mesh object) in different format as OFF, OBJ and PLY).
+   *
+   * The text formats are produced in memory by blocks of vertices or
+   * faces, formatted in parallel when OpenMP is enabled, and written
+   * with one call per block. The output is the same as the one of
+   * the stream operators (the precision and the floating point flags
+   * of the output stream, e.g. std::fixed, are honored). Only the
+   * integers of at most 64 bits and the floating point numbers that fit
+   * in a double are formatted directly, the other coordinate types
+   * (long double, BigInteger...) are written with their stream
+   * operator. PLY files are written in binary little endian encoding.
    * 
    * The exportation can be done automatically according the input file
    * extension with the ">>" operator  
@@ -119,6 +129,40 @@ namespace DGtal
     static bool export2OBJ_colors(std::ostream &out, std::ostream &outMTL,
                                   const std::string nameMTLFile,
                                   const  Mesh<TPoint>  &aMesh);
+
+    /** 
+     * Export a Mesh towards a binary (little endian) PLY format. The
+     * coordinates are stored as doubles (converted with
+     * NumberTraits::castToDouble) and the faces as lists of
+     * unsigned integers. By default the face colors are exported as
+     * "red", "green", "blue" and "alpha" properties (if they are stored
+     * in the Mesh object).
+     * 
+     * @param out the output stream of the exported PLY object (should be opened in binary mode).
+     * @param aMesh the Mesh object to be exported.
+     * @param exportColor true to try to export the face colors if they are stored in the Mesh object (default true). 
+     * @return true if no errors occur.
+     */
+    
+    static bool export2PLY(std::ostream &out, const  Mesh<TPoint>  &aMesh, 
+                           bool exportColor=true);
+
+  private:
+
+    /**
+     * Formats items in memory by blocks and writes them to a stream.
+     * Blocks are formatted in parallel when OpenMP is enabled, and
+     * written in order.
+     *
+     * @tparam TFormatter the type of a functor (std::string&, std::size_t)
+     * appending the item of given index to a string.
+     * @param out the output stream.
+     * @param nbItems the number of items to write.
+     * @param formatter the functor formatting one item.
+     */
+    template <typename TFormatter>
+    static void writeBlocks( std::ostream & out, std::size_t nbItems,
+                             const TFormatter & formatter );
     
     
   };
@@ -130,7 +174,7 @@ namespace DGtal
   /**
    *  'operator>>' for exporting objects of class 'Mesh'.
    *  This operator automatically selects the good method according to
-   *  the filename extension (off, obj).
+   *  the filename extension (off, obj, ply).
    *  
    * @param aMesh the mesh to be exported.
    * @param aFilename the filename of the file to be exported. 
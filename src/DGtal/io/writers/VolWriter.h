@@ -87,6 +87,30 @@ namespace DGtal
     static bool exportVol(const std::string & filename, const Image &aImage, 
                           const bool compressed=true,
                           const Functor & aFunctor = Functor());
+
+    /**
+     * Export an Image with the chunked Vol format (Version 4).
+     *
+     * The domain is cut into cubic bricks of @a brickSize voxels
+     * along each axis, which are zlib compressed independently (in
+     * parallel when DGtal is built with OpenMP). The header is
+     * followed by the index of the compressed sizes of the bricks
+     * (64 bits, little endian) then by the bricks themselves, so that
+     * VolReader can read any subdomain without uncompressing the
+     * whole file.
+     *
+     * @note When DGtal is built with OpenMP, the image is read
+     * concurrently by several threads.
+     *
+     * @param filename name of the output file
+     * @param aImage the image to export
+     * @param brickSize the size of the bricks along each axis (default 32).
+     * @param aFunctor functor used to cast image values
+     * @return true if no errors occur.
+     */
+    static bool exportChunkedVol(const std::string & filename, const Image &aImage,
+                                 const unsigned int brickSize = 32,
+                                 const Functor & aFunctor = Functor());
   };
 }//namespace
 
@@ -41,6 +41,7 @@
 //////////////////////////////////////////////////////////////////////////////
 // Inclusions
 #include <iostream>
+#include <iterator>
 #include "DGtal/base/Common.h"
 #include "DGtal/base/Clone.h"
 #include "DGtal/math/CBinner.h"
@@ -210,6 +211,10 @@ namespace DGtal
 
     /**
        Add the quantities stored in range [it,itE) to the histogram.
+
+       @note On large random-access ranges and with OpenMP, each thread
+       fills its own bins, which are summed at the end.
+
        @tparam TInputIterator any model of boost::InputIterator on Quantity.
        @param it an iterator on the first element of the range [it,itE)
        @param itE an iterator after the last element of the range [it,itE)
@@ -217,6 +222,16 @@ namespace DGtal
     template <typename TInputIterator>
     void addValues( TInputIterator it, TInputIterator itE );
 
+    /**
+       Adds to self the quantities of another histogram, which must
+       have the same bins (typically initialized with the same
+       binner). Call terminate() afterwards.
+
+       @param other the histogram to add.
+       @return a reference on 'this'.
+    */
+    Self & operator+=( const Self & other );
+
     /**
        Should be called when all values have been added.
     */
@@ -316,6 +331,24 @@ namespace DGtal
     */
     void prepare( Bin size );
 
+    /**
+       Add the quantities given by input iterators.
+       @param it an iterator on the first element of the range [it,itE)
+       @param itE an iterator after the last element of the range [it,itE)
+    */
+    template <typename TInputIterator>
+    void addValues( TInputIterator it, TInputIterator itE,
+                    std::input_iterator_tag );
+
+    /**
+       Add the quantities given by random-access iterators, in parallel.
+       @param it an iterator on the first element of the range [it,itE)
+       @param itE an iterator after the last element of the range [it,itE)
+    */
+    template <typename TInputIterator>
+    void addValues( TInputIterator it, TInputIterator itE,
+                    std::random_access_iterator_tag );
+
 
   }; // end of class Histogram
 
@@ -242,6 +242,19 @@ public:
      */
     void terminate();
 
+    /**
+     * Adds to self the samples of another object with the same number
+     * of variables, as if they had been added after the samples of
+     * this object. Hence the samples of several variables may be
+     * accumulated by chunks in parallel and then merged in order.
+     * Samples are kept only if both objects store them.
+     *
+     * @param other the object to add.
+     * @return a reference on 'this'.
+     * @pre terminate() has not been called on both objects.
+     */
+    MultiStatistics & operator+=( const MultiStatistics & other );
+
 
     /** 
      * Reinitializes the object to contain [size] statistical
@@ -0,0 +1,256 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file QuantileSketch.h
+ *
+ * @author DGtal development team (\c dgtal-devel@lists.gforge.liris.cnrs.fr )
+ *
+ * @date 2026/10/19
+ *
+ * Header file for module QuantileSketch.cpp
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(QuantileSketch_RECURSES)
+#error Recursive header files inclusion detected in QuantileSketch.h
+#else // defined(QuantileSketch_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define QuantileSketch_RECURSES
+
+#if !defined QuantileSketch_h
+/** Prevents repeated inclusion of headers. */
+#define QuantileSketch_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "DGtal/kernel/NumberTraits.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class QuantileSketch
+  /**
+    Description of template class 'QuantileSketch' <p> \brief Aim:
+    Approximates the quantiles (median, percentiles) of a stream of
+    sample values in bounded memory, without storing the samples.
+
+    This is a merging t-digest (Dunning and Ertl, "Computing extremely
+    accurate quantiles using t-digests", 2019). The samples are
+    summarized by a sorted list of weighted centroids. The weight of
+    a centroid at quantile \a q is at most \f$ 4 n q(1-q) / \delta
+    \f$, where \a n is the number of samples and \f$ \delta \f$ the
+    compression parameter: centroids are small near the extreme
+    quantiles and large near the median. The number of centroids
+    grows as \f$ O(\delta \log n) \f$, the minimum and maximum are
+    exact and the tails are very accurate. New samples are buffered
+    and summarized by batches (sort and merge), hence the amortized
+    cost of addValue is a few comparisons.
+
+    Two sketches of the same variable can be merged with \ref
+    operator+=, so that a large set of samples may be split into
+    chunks that are summarized in parallel and then reduced.
+
+    @code
+    QuantileSketch<double> sketch( 100.0 );
+    sketch.addValues( v.begin(), v.end() );
+    double med = sketch.median();
+    double p90 = sketch.quantile( 0.9 );
+    @endcode
+
+    @tparam TQuantity the type of the samples, which must be
+    convertible to double through NumberTraits::castToDouble.
+
+    @see Statistic::setQuantileSketch
+   */
+  template <typename TQuantity>
+  class QuantileSketch
+  {
+    // ----------------------- public types ------------------------------
+  public:
+    typedef TQuantity Quantity;
+    typedef QuantileSketch<Quantity> Self;
+    typedef DGtal::uint64_t Size;
+
+    /// A group of samples summarized by their mean and their number.
+    struct Centroid
+    {
+      double mean;   ///< the mean of the grouped samples.
+      double weight; ///< the number of grouped samples.
+      /// Centroids are sorted by their mean.
+      bool operator<( const Centroid & other ) const
+      { return mean < other.mean; }
+    };
+    typedef std::vector<Centroid> Centroids;
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+     * Constructor.
+     * @param compression the compression parameter \f$ \delta \f$
+     * (positive): the larger, the more accurate and the more
+     * centroids. 100 gives rank errors below 1% in the bulk of the
+     * distribution.
+     */
+    QuantileSketch( double compression = 100.0 );
+
+    /**
+     * Clears the object. As if it has just been created.
+     */
+    void clear();
+
+    /**
+     * Adds a new sample value [v].
+     * @param v the new sample value.
+     */
+    void addValue( Quantity v );
+
+    /**
+     * Adds a sequence of sample values, scanning a container from
+     * iterators [b] to [e].
+     *
+     * @tparam Iter any model of boost::InputIterator on Quantity.
+     * @param b an iterator on the starting point.
+     * @param e an iterator after the last point.
+     */
+    template <class Iter>
+    void addValues( Iter b, Iter e );
+
+    /**
+     * Adds to self another sketch (should be of the same variable).
+     * The result summarizes the union of both sets of samples.
+     *
+     * @param other the object to add.
+     * @return a reference on 'this'.
+     */
+    Self & operator+=( const Self & other );
+
+    // ----------------------- Accessors ------------------------------
+  public:
+
+    /// @return the compression parameter.
+    double compression() const;
+
+    /// @return the number of samples.
+    Size samples() const;
+
+    /// @return the minimal sample value (exact), or 0 if empty.
+    double min() const;
+
+    /// @return the maximal sample value (exact), or 0 if empty.
+    double max() const;
+
+    /**
+     * @param q a value in [0,1].
+     * @return an approximation of the quantile of order \a q of the
+     * samples (0 if there is no sample).
+     *
+     * @note Flushes the samples waiting to be summarized, hence it
+     * is not const (as Statistic::median).
+     */
+    double quantile( double q );
+
+    /// @return an approximation of the median of the samples.
+    double median();
+
+    /**
+     * @return the centroids summarizing the samples, sorted by
+     * increasing mean.
+     * @note Flushes the samples waiting to be summarized.
+     */
+    const Centroids & centroids();
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+    /// The compression parameter.
+    double myCompression;
+    /// The centroids summarizing the flushed samples, sorted by mean.
+    Centroids myCentroids;
+    /// The last samples, not yet summarized into centroids.
+    std::vector<double> myBuffer;
+    /// The total weight of the centroids.
+    double myWeight;
+    /// The number of samples.
+    Size mySamples;
+    /// The minimal sample value.
+    double myMin;
+    /// The maximal sample value.
+    double myMax;
+
+    // ------------------------- Internals ------------------------------------
+  private:
+
+    /// @return the number of samples above which the buffer is flushed.
+    std::size_t bufferCapacity() const;
+
+    /**
+     * Summarizes the buffered samples and the given centroids into
+     * the centroids of this sketch.
+     * @param other some centroids sorted by increasing mean.
+     */
+    void flush( const Centroids & other = Centroids() );
+
+  }; // end of class QuantileSketch
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'QuantileSketch'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'QuantileSketch' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TQuantity>
+  std::ostream&
+  operator<< ( std::ostream & out, const QuantileSketch<TQuantity> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/math/QuantileSketch.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined QuantileSketch_h
+
+#undef QuantileSketch_RECURSES
+#endif // else defined(QuantileSketch_RECURSES)
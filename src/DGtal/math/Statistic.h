@@ -45,6 +45,8 @@
 #include "DGtal/base/Common.h"
 #include "DGtal/kernel/CCommutativeRing.h"
 #include "DGtal/kernel/NumberTraits.h"
+#include "DGtal/math/QuantileSketch.h"
+#include <iterator>
 #include <utility>
 #include <vector>
 //////////////////////////////////////////////////////////////////////////////
@@ -59,6 +61,13 @@ namespace DGtal
     efficiency. For multiple variables, sample storage and others,
     see Statistics class.
 
+    The median may be computed exactly by storing the samples (see
+    constructor), or approximated in bounded memory by a QuantileSketch
+    (see setQuantileSketch). Two statistics of the same variable are
+    merged with \ref operator+=, hence a large set of samples may be
+    split into chunks accumulated in parallel and then reduced. This
+    is what addValues does on random-access ranges.
+
     Backported from [ImaGene](https://gforge.liris.cnrs.fr/projects/imagene). \cite Lachaud03b
     
     @see testStatistics.cpp
@@ -179,6 +188,37 @@ namespace DGtal
      */
     Quantity median();
 
+    /**
+     * Return the quantile of order \a q of the Statistic values. It is
+     * exact if the values are stored in the 'Statistic' object
+     * (complexity: linear on average), approximated if a quantile
+     * sketch is used (see setQuantileSketch).
+     *
+     * @param q a value in [0,1], e.g. 0.5 for the median.
+     * @return the quantile of order \a q, or NaN if there is no
+     * value (no sample, or samples that were neither stored nor
+     * summarized by a sketch).
+     */
+    double quantile( double q );
+
+    /**
+     * Summarizes the forthcoming sample values in a mergeable
+     * QuantileSketch, so that median and quantile give approximate
+     * values in bounded memory, without storing the samples. It is
+     * ignored if the samples are stored (exact quantiles).
+     *
+     * @param compression the compression of the sketch (see
+     * QuantileSketch): 100 gives rank errors below 1% in the bulk of
+     * the distribution.
+     * @pre no sample value has been added yet.
+     */
+    void setQuantileSketch( double compression = 100.0 );
+
+    /**
+     * @return 'true' iff quantiles are approximated by a sketch.
+     */
+    bool hasQuantileSketch() const;
+
     /// @param[in] i a valid index
     /// @return the corresponding value (if stored).
     Quantity operator[]( unsigned int i ) const;
@@ -201,6 +241,13 @@ namespace DGtal
      stats.addValue( x + 4, x + 10 );
      @endcode
      *
+     * @note On random-access ranges, the values are accumulated by
+     * blocks of fixed size in a tight loop, and the partial
+     * statistics of the blocks are merged in order (in parallel with
+     * OpenMP). The result does not depend on the number of threads,
+     * but floating-point sums may differ slightly from successive
+     * calls to addValue.
+     *
      * @param b an iterator on the starting point.
      * @param e an iterator after the last point.
      */
@@ -240,9 +287,36 @@ namespace DGtal
     bool OK() const;
   
 
-    // ------------------------- Datas ----------------------------------------
+    // ------------------------- Internals ------------------------------------
   private:
 
+    /**
+     * Adds sample values given by input iterators.
+     * @param b an iterator on the starting point.
+     * @param e an iterator after the last point.
+     */
+    template <class Iter>
+    void addValues( Iter b, Iter e, std::input_iterator_tag );
+
+    /**
+     * Adds sample values given by random-access iterators, by blocks.
+     * @param b an iterator on the starting point.
+     * @param e an iterator after the last point.
+     */
+    template <class Iter>
+    void addValues( Iter b, Iter e, std::random_access_iterator_tag );
+
+    /**
+     * Merges the moments and extrema of some samples into this object.
+     *
+     * @param n the number of samples.
+     * @param sum the sum of their values.
+     * @param sum2 the sum of their squared values.
+     * @param lo their minimal value (if n != 0).
+     * @param hi their maximal value (if n != 0).
+     */
+    void addMoments( unsigned int n, Quantity sum, Quantity sum2,
+                     Quantity lo, Quantity hi );
 
     // ------------------------- Datas ----------------------------------------
   private:
@@ -300,6 +374,16 @@ namespace DGtal
      *
      */
     bool myIsTerminated;
+
+    /**
+     * Tells if quantiles are approximated by the sketch.
+     */
+    bool myUseSketch;
+
+    /**
+     * summarizes the samples to approximate quantiles, if myUseSketch.
+     */
+    QuantileSketch<Quantity> mySketch;
   
   };
 
@@ -141,6 +141,10 @@ namespace DGtal
     /// triangulated by adding a new vertex at the barycenter of the
     /// face vertices.
     ///
+    /// The umbrellas of the faces are computed in parallel when
+    /// DGtal is built with OpenMP, on one copy of \a dsurf per
+    /// thread. The output is the same as the sequential one.
+    ///
     /// @tparam DigitalSurfaceContainer the container chosen for the digital surface.
     /// @tparam CellEmbedder the embedder chosen for the digital surface.
     ///
@@ -162,6 +166,10 @@ namespace DGtal
     /// the dual graph of a 2-dimensional digital surface in K^3 (class
     /// DigitalSurface).
     ///
+    /// The umbrellas of the faces are computed in parallel when
+    /// DGtal is built with OpenMP, as in
+    /// digitalSurface2DualTriangulatedSurface.
+    ///
     /// @tparam DigitalSurfaceContainer the container chosen for the digital surface.
     /// @tparam CellEmbedder the embedder chosen for the digital surface.
     ///
@@ -183,6 +191,12 @@ namespace DGtal
     /// the primal graph of a 2-dimensional digital surface in K^3 (class
     /// DigitalSurface).
     ///
+    /// The pointels of all surfels are first gathered in flat arrays,
+    /// then deduplicated by hashing, each part of the hash space
+    /// being processed by its own thread when DGtal is built with
+    /// OpenMP. Vertices are numbered by order of first occurrence
+    /// along the surfels of \a dsurf.
+    ///
     /// @tparam DigitalSurfaceContainer the container chosen for the digital surface.
     /// @tparam CellEmbedder the embedder chosen for the digital surface.
     /// @tparam CellMap the type for encoding the map 0-cell -> Index.
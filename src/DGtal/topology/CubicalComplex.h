@@ -79,6 +79,31 @@ namespace DGtal
     uint32_t data;
   };
 
+  /**
+   * Description of template class 'CubicalCellContainerInitializer'
+   * <p> \brief Aim: prepares the container storing the cells of
+   * dimension \a d of a CubicalComplex, once the Khalimsky space of
+   * the complex is known. Nothing is done for associative containers
+   * like \c std::map or \c std::unordered_map, but containers
+   * allocated over the whole space (like DenseCellMap) specialize
+   * this class.
+   *
+   * @tparam TKSpace any model of concepts::CCellularGridSpaceND.
+   * @tparam TCellContainer the type of cell container.
+   */
+  template < typename TKSpace, typename TCellContainer >
+  struct CubicalCellContainerInitializer
+  {
+    /**
+     * @param container a container of the complex (unused).
+     * @param aK the Khalimsky space of the complex (unused).
+     * @param d the dimension of the cells stored in \a container (unused).
+     */
+    static void init( TCellContainer& /* container */,
+                      const TKSpace& /* aK */, Dimension /* d */ )
+    {}
+  };
+
   // Forward definitions.
   template < typename TKSpace, typename TCellContainer >
   class CubicalComplex;
@@ -168,6 +193,8 @@ namespace DGtal
   * std::unordered_map. Note that unfortunately, unordered_map are
   * (strangely) not models of boost::AssociativeContainer, hence we
   * cannot check concepts here.
+  * For complexes filling a large part of a bounded space, a
+  * DenseCellMap stores the cells in arrays, with O(1) accesses.
   *
   */
   template < typename TKSpace,
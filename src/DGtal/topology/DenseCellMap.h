@@ -0,0 +1,541 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file DenseCellMap.h
+ *
+ * @author DGtal development team (\c dgtal-devel@lists.gforge.liris.cnrs.fr )
+ *
+ * @date 2026/10/19
+ *
+ * Header file for module DenseCellMap.ih
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(DenseCellMap_RECURSES)
+#error Recursive header files inclusion detected in DenseCellMap.h
+#else // defined(DenseCellMap_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define DenseCellMap_RECURSES
+
+#if !defined DenseCellMap_h
+/** Prevents repeated inclusion of headers. */
+#define DenseCellMap_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <vector>
+#include <string>
+#include <utility>
+#include <iterator>
+#include <new>
+#include <type_traits>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/ConstAlias.h"
+#include "DGtal/base/ContainerTraits.h"
+#include "DGtal/topology/CCellularGridSpaceND.h"
+#include "DGtal/topology/CubicalComplex.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class DenseCellMap
+  /**
+   * Description of template class 'DenseCellMap' <p> \brief Aim:
+   * An associative container mapping the cells of a given dimension
+   * of a bounded Khalimsky space to some data, stored as dense arrays
+   * instead of a tree or a hash table. It is meant to be the cell
+   * container of a CubicalComplex whose cells fill a large part of
+   * its Khalimsky space.
+   *
+   * The cells of dimension \a k are split into the \f$ \binom{n}{k}
+   * \f$ regular grids of cells having their odd Khalimsky coordinates
+   * along the same axes. Each grid is linearized, hence a cell is
+   * found by a few integer operations and is stored with one byte
+   * (occupancy) plus its data. Iterators visit the occupied cells in
+   * the order of the arrays, skipping empty places by blocks.
+   *
+   * A DenseCellMap is a model of concepts::CSTLAssociativeContainer
+   * and of pair associative container, with unique and unordered
+   * keys. It differs from a \c std::unordered_map in two ways:
+   *
+   * - it must be initialized with a Khalimsky space and a cell
+   *   dimension (see init()) before any insertion. A CubicalComplex
+   *   does it automatically through CubicalCellContainerInitializer.
+   *
+   * - values are not stored, hence dereferencing an iterator gives a
+   *   proxy whose member \c first is a copy of the cell and whose
+   *   member \c second is a reference to the data. This proxy lives
+   *   within the iterator, hence references to \c first are valid as
+   *   long as the iterator is not modified.
+   *
+   * Insertions, deletions and lookups are O(1), and do not invalidate
+   * iterators (except the ones pointing to erased cells).
+   *
+   * @code
+   * typedef KhalimskySpaceND<3,int>                  KSpace;
+   * typedef DenseCellMap< KSpace, CubicalCellData >  Map;
+   * typedef CubicalComplex< KSpace, Map >            CC;
+   * KSpace K;
+   * K.init( Point( 0,0,0 ), Point( 100,100,100 ), true );
+   * CC complex( K ); // each dense map is allocated here.
+   * @endcode
+   *
+   * @tparam TKSpace any model of concepts::CCellularGridSpaceND, i.e. a type
+   * that models a Khalimsky space.
+   *
+   * @tparam TData the type of data associated to each cell, which
+   * must be default constructible and copyable.
+   */
+  template < typename TKSpace, typename TData >
+  class DenseCellMap
+  {
+    BOOST_CONCEPT_ASSERT(( concepts::CCellularGridSpaceND< TKSpace > ));
+
+    // ----------------------- associated types ------------------------------
+  public:
+    typedef DenseCellMap< TKSpace, TData > Self;
+    typedef TKSpace                        KSpace;  ///< Type of the cellular grid space.
+    typedef TData                          Data;    ///< Type of data associated to each cell.
+    typedef typename KSpace::Cell          Cell;    ///< Type for a cell in the space.
+    typedef typename KSpace::Point         Point;   ///< Type for a point in the space.
+    typedef typename KSpace::Integer       Integer; ///< Type for integers in the space.
+    static const Dimension dimension = KSpace::dimension;
+
+    typedef Cell                           key_type;
+    typedef Data                           mapped_type;
+    typedef std::pair< const Cell, Data >  value_type;
+    typedef std::size_t                    size_type;
+    typedef std::ptrdiff_t                 difference_type;
+    typedef size_type                      Size;
+
+    /**
+     * Proxy to a stored pair (cell, data), given by the iterators of
+     * the container.
+     * @tparam TDataReference either 'Data&' or 'const Data&'.
+     */
+    template < typename TDataReference >
+    struct CellDataReference
+    {
+      Cell           first;  ///< the cell.
+      TDataReference second; ///< the data associated to the cell.
+
+      /**
+       * Constructor.
+       * @param aCell the cell.
+       * @param aData a reference to the data associated to \a aCell.
+       */
+      CellDataReference( const Cell& aCell, TDataReference aData )
+        : first( aCell ), second( aData ) {}
+
+      /// @return the (cell, data) pair as a value.
+      operator value_type() const
+      {
+        return value_type( first, second );
+      }
+    };
+
+    typedef CellDataReference< Data& >       reference;
+    typedef CellDataReference< const Data& > const_reference;
+    typedef reference*                       pointer;
+    typedef const_reference*                 const_pointer;
+
+    /**
+     * Forward iterator visiting the occupied cells of a DenseCellMap.
+     * @tparam TMap either 'DenseCellMap' or 'const DenseCellMap'.
+     * @tparam TReference either 'reference' or 'const_reference'.
+     */
+    template < typename TMap, typename TReference >
+    class GenericIterator
+    {
+    public:
+      typedef std::forward_iterator_tag           iterator_category;
+      typedef typename DenseCellMap::value_type   value_type;
+      typedef std::ptrdiff_t                      difference_type;
+      typedef TReference&                         reference;
+      typedef TReference*                         pointer;
+
+      friend class DenseCellMap;
+      template < typename TOtherMap, typename TOtherReference >
+      friend class GenericIterator;
+
+      /// Default constructor (singular iterator).
+      GenericIterator() : myMap( 0 ), myIndex( 0 ) {}
+
+      /**
+       * Constructor.
+       * @param aMap the visited container.
+       * @param index the index of an occupied place in \a aMap or its
+       * number of places.
+       */
+      GenericIterator( TMap& aMap, Size index )
+        : myMap( &aMap ), myIndex( index ) {}
+
+      /**
+       * Copy constructor. The proxy is not copied.
+       * @param other the object to clone.
+       */
+      GenericIterator( const GenericIterator& other )
+        : myMap( other.myMap ), myIndex( other.myIndex ) {}
+
+      /**
+       * Conversion from a mutable iterator to a constant one.
+       * @param other any iterator of compatible type.
+       */
+      template < typename TOtherMap, typename TOtherReference >
+      GenericIterator( const GenericIterator< TOtherMap, TOtherReference >& other,
+                       typename std::enable_if< std::is_convertible< TOtherMap*, TMap* >::value >::type* = 0 )
+        : myMap( other.myMap ), myIndex( other.myIndex ) {}
+
+      /**
+       * Assignment.
+       * @param other the object to copy.
+       * @return a reference on 'this'.
+       */
+      GenericIterator& operator=( const GenericIterator& other )
+      {
+        myMap   = other.myMap;
+        myIndex = other.myIndex;
+        return *this;
+      }
+
+      /// @return a reference to the proxy (cell, data) pointed by this.
+      reference operator*() const
+      {
+        return *new ( &myProxy ) TReference( myMap->cellAt( myIndex ),
+                                            myMap->myData[ myIndex ] );
+      }
+
+      /// @return a pointer to the proxy (cell, data) pointed by this.
+      pointer operator->() const
+      {
+        return &( operator*() );
+      }
+
+      /// Pre-increment. @return a reference on 'this'.
+      GenericIterator& operator++()
+      {
+        myIndex = myMap->nextOccupied( myIndex + 1 );
+        return *this;
+      }
+
+      /// Post-increment. @return the iterator before incrementation.
+      GenericIterator operator++( int )
+      {
+        GenericIterator tmp( *this );
+        ++( *this );
+        return tmp;
+      }
+
+      /**
+       * @param other any iterator.
+       * @return 'true' iff both iterators point to the same place.
+       */
+      template < typename TOtherMap, typename TOtherReference >
+      bool operator==( const GenericIterator< TOtherMap, TOtherReference >& other ) const
+      {
+        return myIndex == other.myIndex;
+      }
+
+      /**
+       * @param other any iterator.
+       * @return 'true' iff both iterators point to different places.
+       */
+      template < typename TOtherMap, typename TOtherReference >
+      bool operator!=( const GenericIterator< TOtherMap, TOtherReference >& other ) const
+      {
+        return myIndex != other.myIndex;
+      }
+
+    private:
+      /// The visited container.
+      TMap* myMap;
+      /// The index of the current place.
+      Size myIndex;
+      /// The storage of the proxy (rebuilt at each dereferencing).
+      mutable typename std::aligned_storage< sizeof( TReference ),
+                                             alignof( TReference ) >::type myProxy;
+    };
+
+    typedef GenericIterator< Self, reference >             iterator;
+    typedef GenericIterator< const Self, const_reference > const_iterator;
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+     * Default constructor. The object is not valid (and has no
+     * place) until init() is called.
+     */
+    DenseCellMap();
+
+    /**
+     * Constructor.
+     * @param aK the cellular grid space.
+     * @param d the dimension of the stored cells.
+     * @see init
+     */
+    DenseCellMap( ConstAlias<KSpace> aK, Dimension d );
+
+    /**
+     * Initializes the container so that it may store any cell of
+     * dimension \a d of \a aK. The container is cleared.
+     * @param aK the cellular grid space, referenced by the container.
+     * @param d the dimension of the stored cells.
+     */
+    void init( ConstAlias<KSpace> aK, Dimension d );
+
+    /// @return the dimension of the stored cells.
+    Dimension cellDimension() const;
+
+    /**
+     * Swaps the content of this container with \a other.
+     * @param other any container.
+     */
+    void swap( DenseCellMap& other );
+
+    // ----------------------- Container services ------------------------------
+  public:
+
+    /// @return the number of stored cells.
+    Size size() const;
+
+    /// @return the number of places, i.e. the maximal number of cells.
+    Size max_size() const;
+
+    /// @return 'true' iff the container stores no cell.
+    bool empty() const;
+
+    /// Removes all the cells, but keeps the places.
+    void clear();
+
+    /// @return an iterator on the first stored cell.
+    iterator begin();
+    /// @return an iterator after the last stored cell.
+    iterator end();
+    /// @return a constant iterator on the first stored cell.
+    const_iterator begin() const;
+    /// @return a constant iterator after the last stored cell.
+    const_iterator end() const;
+
+    /**
+     * @param aCell any cell.
+     * @return an iterator pointing to \a aCell if it is stored, end() otherwise.
+     */
+    iterator find( const Cell& aCell );
+
+    /**
+     * @param aCell any cell.
+     * @return a constant iterator pointing to \a aCell if it is stored, end() otherwise.
+     */
+    const_iterator find( const Cell& aCell ) const;
+
+    /**
+     * @param aCell any cell.
+     * @return 1 if \a aCell is stored, 0 otherwise.
+     */
+    Size count( const Cell& aCell ) const;
+
+    /**
+     * @param aCell any cell.
+     * @return the range of the cells equal to \a aCell (empty or with one element).
+     */
+    std::pair< iterator, iterator > equal_range( const Cell& aCell );
+
+    /**
+     * @param aCell any cell.
+     * @return the range of the cells equal to \a aCell (empty or with one element).
+     */
+    std::pair< const_iterator, const_iterator > equal_range( const Cell& aCell ) const;
+
+    /**
+     * Inserts a cell with its data, if the cell is not already stored.
+     * @param value a pair (cell, data), where the cell has the
+     * dimension given at initialization and lies within the space.
+     * @return an iterator pointing to the cell, and 'true' iff it was inserted.
+     */
+    std::pair< iterator, bool > insert( const value_type& value );
+
+    /**
+     * Inserts a cell with its data, if the cell is not already stored.
+     * @param hint an iterator, not used.
+     * @param value a pair (cell, data), where the cell has the
+     * dimension given at initialization and lies within the space.
+     * @return an iterator pointing to the cell.
+     */
+    iterator insert( const_iterator hint, const value_type& value );
+
+    /**
+     * @param aCell a cell having the dimension given at initialization
+     * and lying within the space. It is inserted with a default data
+     * if it is not already stored.
+     * @return a reference to the data associated to \a aCell.
+     */
+    Data& operator[]( const Cell& aCell );
+
+    /**
+     * Removes a cell.
+     * @param aCell any cell.
+     * @return the number of removed cells (0 or 1).
+     */
+    Size erase( const Cell& aCell );
+
+    /**
+     * Removes a cell.
+     * @param position an iterator pointing to a stored cell.
+     * @return an iterator pointing to the next stored cell.
+     */
+    iterator erase( const_iterator position );
+
+    /**
+     * Removes a range of cells.
+     * @param first an iterator pointing to a stored cell.
+     * @param last an iterator pointing to a stored cell after \a first, or end().
+     * @return an iterator pointing to the next stored cell.
+     */
+    iterator erase( const_iterator first, const_iterator last );
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    /// @return the class name.
+    std::string className() const;
+
+    // ------------------------- Protected Datas ------------------------------
+  protected:
+
+    /// The regular grid of the cells having odd coordinates along the same axes.
+    struct CellGrid
+    {
+      unsigned int oddAxes; ///< the bit k is set iff the k-th coordinate is odd.
+      Point        first;   ///< Khalimsky coordinates of the first cell of the grid.
+      Point        extent;  ///< number of cells along each axis.
+      Size         offset;  ///< index of the first cell of the grid.
+      Size         size;    ///< number of cells of the grid.
+    };
+
+    /// The cellular grid space.
+    const KSpace* myKSpace;
+    /// The dimension of the stored cells.
+    Dimension myCellDimension;
+    /// The grids of the cells of dimension myCellDimension.
+    std::vector< CellGrid > myGrids;
+    /// For each mask of odd axes, the index of its grid or -1.
+    std::vector< int > myGridIndex;
+    /// For each place, 1 iff a cell is stored there, 0 otherwise.
+    std::vector< unsigned char > myOccupancy;
+    /// For each place, the data of the stored cell.
+    std::vector< Data > myData;
+    /// The number of stored cells.
+    Size mySize;
+
+    // ------------------------- Hidden services ------------------------------
+  protected:
+
+    /**
+     * @param aCell any cell.
+     * @return the place of \a aCell, or max_size() if the cell
+     * has not the right dimension or lies outside the space.
+     */
+    Size indexOf( const Cell& aCell ) const;
+
+    /**
+     * @param index the index of a place.
+     * @return the cell stored at this place.
+     */
+    Cell cellAt( Size index ) const;
+
+    /**
+     * @param index the index of a place.
+     * @return the first occupied place from \a index, or max_size().
+     */
+    Size nextOccupied( Size index ) const;
+
+  }; // end of class DenseCellMap
+
+  /**
+   * Specialization of ContainerTraits for DenseCellMap, which behaves
+   * as an unordered map.
+   */
+  template < typename TKSpace, typename TData >
+  struct ContainerTraits< DenseCellMap< TKSpace, TData > >
+  {
+    typedef UnorderedMapAssociativeCategory Category;
+  };
+
+  /**
+   * Specialization of CubicalCellContainerInitializer for
+   * DenseCellMap: the container storing the cells of dimension \a d of
+   * a complex is allocated for all the cells of dimension \a d of the
+   * space of the complex.
+   */
+  template < typename TKSpace, typename TData >
+  struct CubicalCellContainerInitializer< TKSpace, DenseCellMap< TKSpace, TData > >
+  {
+    /**
+     * @param container a container of the complex.
+     * @param aK the Khalimsky space of the complex.
+     * @param d the dimension of the cells stored in \a container.
+     */
+    static void init( DenseCellMap< TKSpace, TData >& container,
+                      const TKSpace& aK, Dimension d )
+    {
+      container.init( aK, d );
+    }
+  };
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'DenseCellMap'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'DenseCellMap' to write.
+   * @return the output stream after the writing.
+   */
+  template < typename TKSpace, typename TData >
+  std::ostream&
+  operator<< ( std::ostream & out, const DenseCellMap< TKSpace, TData > & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/topology/DenseCellMap.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined DenseCellMap_h
+
+#undef DenseCellMap_RECURSES
+#endif // else defined(DenseCellMap_RECURSES)
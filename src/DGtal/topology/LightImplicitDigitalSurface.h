@@ -48,6 +48,7 @@
 #include "DGtal/topology/Topology.h"
 #include "DGtal/topology/SurfelAdjacency.h"
 #include "DGtal/topology/SurfelNeighborhood.h"
+#include "DGtal/topology/SurfelMarkSet.h"
 #include "DGtal/graph/BreadthFirstVisitor.h"
 #include "DGtal/graph/GraphVisitorRange.h"
 //////////////////////////////////////////////////////////////////////////////
@@ -67,6 +68,9 @@ namespace DGtal
   It is also a model of CUndirectedSimpleLocalGraph, so as to be able
   to visit itself with a BreadthFirstVisitor. The "Light" or
   lazyness is implemented this way.
+  The visited surfels are marked in a SurfelMarkSet, i.e. a bitmap
+  indexed by the Khalimsky coordinates of the surfels, instead of a
+  \c std::set.
   
   @tparam TKSpace a model of CCellularGridSpaceND: the type chosen
   for the cellular grid space.
@@ -227,7 +231,8 @@ namespace DGtal
     };
 
     // -------------------- specific types ------------------------------
-    typedef BreadthFirstVisitor< Self > SelfVisitor;
+    typedef SurfelMarkSet< KSpace > SurfelMarks;
+    typedef BreadthFirstVisitor< Self, SurfelMarks > SelfVisitor;
     typedef GraphVisitorRange< SelfVisitor > SelfVisitorRange;
     typedef typename SelfVisitorRange::ConstIterator SurfelConstIterator;
     typedef typename KSpace::Space Space;
@@ -41,6 +41,7 @@
 // Inclusions
 #include <iostream>
 #include <bitset>
+#include <cstddef>
 #include <unordered_map>
 #include "boost/dynamic_bitset.hpp"
 #include <DGtal/base/CountedPtr.h>
@@ -114,6 +115,64 @@ namespace DGtal {
   std::unordered_map<TPoint, NeighborhoodConfiguration > >
   mapZeroPointNeighborhoodToConfigurationMask();
 
+  /**
+   * Returns the precomputed simplicity table of a (foreground,
+   * background) pair of adjacencies, among the tables distributed
+   * with DGtal (see "DGtal/topology/tables/NeighborhoodTables.h"):
+   * (4,8) and (8,4) in 2D, (6,18), (6,26), (18,6) and (26,6) in 3D.
+   * A table is loaded the first time it is requested, and shared by
+   * all subsequent requests. It is never released, and this function
+   * may be called concurrently by several threads.
+   *
+   * @param foregroundSize the number of neighbors of the foreground adjacency (e.g. 26).
+   * @param backgroundSize the number of neighbors of the background adjacency (e.g. 6).
+   *
+   * @return a pointer to the table, or nullptr if no table exists for
+   * this pair of adjacencies or if its file can't be read.
+   */
+  inline
+  const boost::dynamic_bitset<> *
+  getSimplicityTable( const unsigned int foregroundSize,
+                      const unsigned int backgroundSize );
+
+  /**
+   * Computes the occupancy configuration of the 8 neighbors of a
+   * pixel directly from a dense image, with the bit order of
+   * mapZeroPointNeighborhoodToConfigurationMask. Each row of three
+   * pixels gives three consecutive bits, then the bit of the center
+   * is squeezed out.
+   *
+   * @param center pointer to the pixel in a row-major array of bytes
+   * equal to 0 (background) or 1 (foreground), whose 8 neighbors lie
+   * in the array.
+   * @param rowStride the offset between two consecutive rows.
+   *
+   * @return bit configuration of the neighborhood.
+   */
+  inline
+  NeighborhoodConfiguration
+  getDenseNeighborhoodConfiguration( const unsigned char * center,
+                                     const std::ptrdiff_t rowStride );
+
+  /**
+   * Computes the occupancy configuration of the 26 neighbors of a
+   * voxel directly from a dense image, with the bit order of
+   * mapZeroPointNeighborhoodToConfigurationMask.
+   *
+   * @param center pointer to the voxel in a row-major array of bytes
+   * equal to 0 (background) or 1 (foreground), whose 26 neighbors lie
+   * in the array.
+   * @param rowStride the offset between two consecutive rows.
+   * @param sliceStride the offset between two consecutive slices.
+   *
+   * @return bit configuration of the neighborhood.
+   */
+  inline
+  NeighborhoodConfiguration
+  getDenseNeighborhoodConfiguration( const unsigned char * center,
+                                     const std::ptrdiff_t rowStride,
+                                     const std::ptrdiff_t sliceStride );
+
   } // namespace functions
 } // namespace DGtal
 
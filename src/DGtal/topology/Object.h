@@ -281,6 +281,31 @@ namespace DGtal
      */
     void setTable(Alias<boost::dynamic_bitset<> >inputTable);
 
+    /**
+     * Selects the pre-computed look up table matching the topology of
+     * the object (4_8, 8_4 in 2D, 6_18, 6_26, 18_6, 26_6 in 3D) to
+     * speed up isSimple calculation, instead of a table set with
+     * setTable. Tables are loaded at the first isSimple call and
+     * shared by all objects.
+     *
+     * @note objects whose adjacencies are both MetricAdjacency select
+     * their table automatically, other objects (e.g. with a
+     * DomainAdjacency, whose geodesic neighborhoods stop at the domain
+     * border) have to call this method.
+     *
+     * @return 'true' if a table exists for this topology, 'false'
+     * otherwise (the object is then left unchanged).
+     *
+     * @see functions::getSimplicityTable
+     */
+    bool setTableFromTopology();
+
+    /**
+     * Removes the look up table, set with setTable or selected from
+     * the topology: isSimple then uses the geodesic neighborhoods.
+     */
+    void unsetTable();
+
     /**
      * Get the occupancy configuration of the neighborhood of a point. The neighborhood only depends on the dimension, not the topology of the object (3x3 cube for 3D point, 2x2 square for 2D).
      * @param center point of the neighborhood. It doesn't matter if center belongs or not to \b input_object.
@@ -624,6 +649,28 @@ objects[ 0 ].writeComponents( it ); // it points in same container as this.
         const boost::dynamic_bitset<> & input_table,
 	const std::unordered_map< Point,
 	  NeighborhoodConfiguration > & mapZeroNeighborhoodToMask) const;
+
+    /**
+     * Checks the simplicity of a range of points at once.
+     *
+     * When a table is used (see setTable and setTableFromTopology),
+     * the object is first copied into a dense image of bytes around
+     * the bounding box of the points, then each configuration is
+     * computed with getDenseNeighborhoodConfiguration and looked up
+     * in the table, in parallel when OpenMP is enabled. Otherwise,
+     * each point is checked in turn with isSimple( const Point & ).
+     *
+     * @tparam TInputIterator the type of an input iterator on points.
+     * @tparam TOutputIterator the type of an output iterator on bool.
+     * @param itb the beginning of the range of points.
+     * @param ite the end of the range of points.
+     * @param out the output iterator where the simplicity of each point is written, in order.
+     *
+     * @return the output iterator after the writing.
+     */
+    template <typename TInputIterator, typename TOutputIterator>
+    TOutputIterator isSimple( TInputIterator itb, TInputIterator ite,
+                              TOutputIterator out ) const;
     // ----------------------- Interface --------------------------------------
   public:
 
@@ -674,6 +721,30 @@ objects[ 0 ].writeComponents( it ); // it points in same container as this.
      */
     bool myTableIsLoaded;
 
+    /**
+     * Flag to use the table matching the topology (see
+     * functions::getSimplicityTable) in isSimple calculation, when no
+     * table is loaded.
+     */
+    bool myTableFromTopology;
+
+    // ------------------------- Hidden services ------------------------------
+  private:
+
+    /**
+     * @return the table used by isSimple, either the loaded one or the
+     * one matching the topology, or nullptr if isSimple uses the
+     * geodesic neighborhoods.
+     */
+    const boost::dynamic_bitset<> * simplicityTable() const;
+
+    /**
+     * @return the mapping of the neighborhood of point Zero to masks
+     * matching simplicityTable().
+     */
+    const std::unordered_map<Point, NeighborhoodConfiguration> &
+    neighborConfigurationMap() const;
+
     // --------------- CDrawableWithBoard2D realization ------------------
   public:
     /**
@@ -71,6 +71,13 @@ namespace DGtal
  * lower than the complex.
  * Paper: Chaussard, J. and Couprie, M., Surface Thinning in 3D Cubical Complexes,
  * Combinatorial Image Analysis, (2009)
+ *
+ * Each iteration is made of one sub-iteration per direction,
+ * orientation and dimension. The free pairs of a sub-iteration are
+ * independent, hence they are all detected in parallel (OpenMP) on a
+ * snapshot of the complex, then removed together. Lookups dominate,
+ * so a complex stored in a std::unordered_map is faster than in a
+ * std::map.
  * @tparam CC cubical complex.
  */
 template < typename CC >
@@ -156,7 +163,9 @@ private:
     int getDirection ( const Cell& F, const Cell& G ) const;
 
      /**
-     * Calculate an orientation of a freepair.
+     * Find the cell G such that (F,G) is a free pair of the given
+     * orientation and direction: G is maximal and is the only cell of
+     * the complex having F as a face. Neither F nor G is FIXED.
      * @param F -- cell of a dimension one lower than G.
      * @param G -- cell of a dimension one higher than F.
      * @param orient -- freepair orientation
@@ -164,7 +173,7 @@ private:
      * @return -- true if G was found as collapisble, false
      * otherwise.
      */
-    bool completeFreepair ( CellMapConstIterator F, Cell& G, int orient, int dir );
+    bool completeFreepair ( CellMapConstIterator F, Cell& G, int orient, int dir ) const;
 
     /**
      * Check if a given face of dimension n is included in a face of dimmension n + 1.
@@ -0,0 +1,364 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file SurfelMarkSet.h
+ *
+ * @author DGtal development team (\c dgtal-devel@lists.gforge.liris.cnrs.fr )
+ *
+ * @date 2026/10/19
+ *
+ * @brief Set of signed surfels stored as a paged bitmap on their
+ * linearized Khalimsky coordinates
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(SurfelMarkSet_RECURSES)
+#error Recursive header files inclusion detected in SurfelMarkSet.h
+#else // defined(SurfelMarkSet_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define SurfelMarkSet_RECURSES
+
+#if !defined SurfelMarkSet_h
+/** Prevents repeated inclusion of headers. */
+#define SurfelMarkSet_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <iterator>
+#include <vector>
+#include <set>
+#include <array>
+#include <utility>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/ConstAlias.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class SurfelMarkSet
+  /**
+   * Description of template class 'SurfelMarkSet' <p> \brief Aim: A
+   * set of signed surfels of a Khalimsky space, meant to mark the
+   * visited surfels of a traversal (e.g. the MarkSet of a
+   * BreadthFirstVisitor over a digital surface).
+   *
+   * When it is built from a Khalimsky space, the surfels orthogonal
+   * to each axis form a regular grid, which is linearized, and a
+   * surfel is stored as one bit (per sign) of a bitmap: insertions
+   * and lookups cost a few integer operations instead of the
+   * comparisons of a \c std::set. The bitmap is split into pages
+   * allocated at the first insertion, so that the memory is
+   * proportional to the part of the space crossed by the surface. If
+   * the space is too big for its page table (or if the set is default
+   * constructed), the surfels are stored in a \c std::set.
+   *
+   * Iterators visit the surfels in the order of the bitmap (or of the
+   * \c std::set) and are not invalidated by insertions or deletions,
+   * except the ones pointing to erased surfels. Dereferencing an
+   * iterator gives a copy of the surfel.
+   *
+   * @code
+   * typedef SurfelMarkSet< KSpace > MarkSet;
+   * BreadthFirstVisitor< Surface, MarkSet > visitor( surface, bel, MarkSet( K ) );
+   * @endcode
+   *
+   * @tparam TKSpace the type of Khalimsky space (KhalimskySpaceND).
+   */
+  template <typename TKSpace>
+  class SurfelMarkSet
+  {
+    // ----------------------- associated types ------------------------------
+  public:
+    typedef SurfelMarkSet<TKSpace> Self;
+    typedef TKSpace KSpace;
+    typedef typename KSpace::SCell Surfel;
+    typedef typename KSpace::Point Point;
+    typedef typename KSpace::Integer Integer;
+    typedef std::size_t Size;
+
+    typedef Surfel key_type;
+    typedef Surfel value_type;
+    typedef std::size_t size_type;
+
+  private:
+    /// Type of the words of the bitmap.
+    typedef DGtal::uint64_t Word;
+    /// Type of the fallback container.
+    typedef std::set<Surfel> SurfelSet;
+
+  public:
+    /**
+     * Forward iterator on the surfels of a SurfelMarkSet.
+     */
+    class ConstIterator
+    {
+    public:
+      typedef std::forward_iterator_tag iterator_category;
+      typedef Surfel value_type;
+      typedef std::ptrdiff_t difference_type;
+      typedef Surfel reference;
+      typedef const Surfel* pointer;
+
+      friend class SurfelMarkSet;
+
+      /// Default constructor (singular iterator).
+      ConstIterator() : mySet( 0 ), myIndex( 0 ) {}
+
+      /// @return the pointed surfel.
+      Surfel operator*() const
+      {
+        return mySet->isDense() ? mySet->surfel( myIndex ) : *myIt;
+      }
+
+      /// Pre-increment. @return a reference on 'this'.
+      ConstIterator & operator++()
+      {
+        if ( mySet->isDense() )
+          myIndex = mySet->nextIndex( myIndex + 1 );
+        else
+          ++myIt;
+        return *this;
+      }
+
+      /// Post-increment. @return the iterator before incrementation.
+      ConstIterator operator++( int )
+      {
+        ConstIterator tmp( *this );
+        ++( *this );
+        return tmp;
+      }
+
+      /**
+       * @param other any iterator on the same set.
+       * @return 'true' iff both iterators point to the same place.
+       */
+      bool operator==( const ConstIterator & other ) const
+      {
+        return ( myIndex == other.myIndex ) && ( myIt == other.myIt );
+      }
+
+      /**
+       * @param other any iterator on the same set.
+       * @return 'true' iff both iterators point to different places.
+       */
+      bool operator!=( const ConstIterator & other ) const
+      {
+        return ! ( *this == other );
+      }
+
+    private:
+      /**
+       * Constructor.
+       * @param aSet the visited set.
+       * @param index the index of a set bit (or the number of bits).
+       * @param it an iterator in the fallback container.
+       */
+      ConstIterator( const SurfelMarkSet & aSet, Size index,
+                     typename SurfelSet::const_iterator it )
+        : mySet( &aSet ), myIndex( index ), myIt( it ) {}
+
+      /// The visited set.
+      const SurfelMarkSet* mySet;
+      /// The index of the current bit (dense mode).
+      Size myIndex;
+      /// The current surfel (fallback mode).
+      typename SurfelSet::const_iterator myIt;
+    };
+
+    typedef ConstIterator const_iterator;
+    typedef ConstIterator iterator;
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+     * Default constructor. The surfels are stored in a \c std::set.
+     */
+    SurfelMarkSet();
+
+    /**
+     * Constructor. The surfels are stored in a bitmap if the page
+     * table of @a aK is not too big, in a \c std::set otherwise.
+     *
+     * @param aK the Khalimsky space of the surfels (aliased).
+     */
+    SurfelMarkSet( ConstAlias<KSpace> aK );
+
+    /**
+     * Destructor.
+     */
+    ~SurfelMarkSet();
+
+    // ----------------------- Container services ------------------------------
+  public:
+
+    /// @return 'true' iff the surfels are stored in the bitmap.
+    bool isDense() const
+    {
+      return myNbBits != 0;
+    }
+
+    /// @return the number of surfels.
+    Size size() const;
+
+    /// @return 'true' iff the set has no surfel.
+    bool empty() const;
+
+    /// Removes all the surfels (and the pages of the bitmap).
+    void clear();
+
+    /// @return an iterator on the first surfel.
+    ConstIterator begin() const;
+
+    /// @return an iterator after the last surfel.
+    ConstIterator end() const;
+
+    /**
+     * @param s any surfel of the space.
+     * @return an iterator pointing to @a s if it belongs to the set,
+     * end() otherwise.
+     */
+    ConstIterator find( const Surfel & s ) const;
+
+    /**
+     * @param s any surfel of the space.
+     * @return 1 if @a s belongs to the set, 0 otherwise.
+     */
+    Size count( const Surfel & s ) const;
+
+    /**
+     * Inserts a surfel.
+     * @param s any surfel of the space.
+     * @return an iterator pointing to @a s, and 'true' iff it was
+     * inserted.
+     */
+    std::pair<ConstIterator, bool> insert( const Surfel & s );
+
+    /**
+     * Removes a surfel.
+     * @param s any surfel of the space.
+     * @return the number of removed surfels (0 or 1).
+     */
+    Size erase( const Surfel & s );
+
+    /**
+     * Removes a surfel.
+     * @param position an iterator pointing to a surfel of the set.
+     */
+    void erase( ConstIterator position );
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+
+    /// Number of bits of a page (log2).
+    static const unsigned int PAGE_SHIFT = 15;
+    /// Maximal number of pages, above which the std::set is used.
+    static const Size MAX_NB_PAGES = Size( 1 ) << 18;
+
+    /// The Khalimsky space.
+    const KSpace* myKSpace;
+    /// The digital lower bound of the space.
+    Point myLowerBound;
+    /// The index of the first surfel orthogonal to each axis.
+    std::array<Size, KSpace::dimension> myOffsets;
+    /// The strides of the grid of the surfels orthogonal to each axis.
+    std::array< std::array<Size, KSpace::dimension>, KSpace::dimension > myStrides;
+    /// The number of bits (two per surfel), 0 if the std::set is used.
+    Size myNbBits;
+    /// The pages of the bitmap (empty if not allocated).
+    std::vector< std::vector<Word> > myPages;
+    /// The surfels if the bitmap is not used.
+    SurfelSet mySurfels;
+    /// The number of surfels.
+    Size mySize;
+
+    // ------------------------- Internals ------------------------------------
+  private:
+
+    /**
+     * @param s any surfel of the space.
+     * @return the index of its bit.
+     */
+    Size index( const Surfel & s ) const;
+
+    /**
+     * @param anIndex the index of a bit.
+     * @return the corresponding surfel.
+     */
+    Surfel surfel( Size anIndex ) const;
+
+    /**
+     * @param anIndex the index of a bit.
+     * @return 'true' iff this bit is set.
+     */
+    bool test( Size anIndex ) const;
+
+    /**
+     * @param anIndex the index of a bit.
+     * @return the index of the first set bit from @a anIndex, or the
+     * number of bits.
+     */
+    Size nextIndex( Size anIndex ) const;
+
+  }; // end of class SurfelMarkSet
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'SurfelMarkSet'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'SurfelMarkSet' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TKSpace>
+  std::ostream&
+  operator<< ( std::ostream & out, const SurfelMarkSet<TKSpace> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/topology/SurfelMarkSet.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined SurfelMarkSet_h
+
+#undef SurfelMarkSet_RECURSES
+#endif // else defined(SurfelMarkSet_RECURSES)
@@ -230,6 +230,58 @@ namespace DGtal
             const PointPredicate & pp,
             const SCell & start_surfel );
 
+    /**
+       Function that extracts a boundary component of a nD digital
+       shape (specified by a predicate on point), in a nD KSpace,
+       without following surfels one after the other. All the bels
+       of the space are first found by a parallel scan of the image
+       (see sParallelMakeBoundary), then the adjacencies between bels
+       are computed independently for each bel with the same local
+       rules as trackBoundary (or trackClosedBoundary if @a closed is
+       'true'). The component containing @a start_surfel is then
+       extracted from this bel graph. The output surfel set is thus
+       the same as the one of trackBoundary (resp. trackClosedBoundary).
+
+       When some bel of the component touches the bounds of the space
+       (so that it is not found by the scan), the method falls back
+       to the sequential tracking.
+
+       @note When DGtal is built with OpenMP, the predicate @a pp is
+       called concurrently by several threads and must be thread-safe
+       for const accesses.
+
+       @tparam SCellSet a model of a set of SCell (e.g., std::set<SCell>).
+
+       @tparam PointPredicate a model of concepts::CPointPredicate describing
+       the inside of a digital shape, meaning a functor taking a Point
+       and returning 'true' whenever the point belongs to the shape.
+
+       @param surface (modified) a set of cells (which are all surfels),
+       the boundary component of [spelset] which touches [start_surfel].
+
+       @param K any space.
+       @param surfel_adj the surfel adjacency chosen for the tracking.
+
+       @param pp an instance of a model of concepts::CPointPredicate, for
+       instance a SetPredicate for a digital set representing a shape,
+       which should be at least partially included in the bounds of
+       space [K].
+
+       @param start_surfel a signed surfel which should be between an
+       element of [shape] and an element not in [shape].
+
+       @param closed when 'true', only direct orientations are
+       followed, as in trackClosedBoundary (default is 'false').
+    */
+    template <typename SCellSet, typename PointPredicate >
+    static
+    void parallelTrackBoundary( SCellSet & surface,
+                                const KSpace & K,
+                                const SurfelAdjacency<KSpace::dimension> & surfel_adj,
+                                const PointPredicate & pp,
+                                const SCell & start_surfel,
+                                bool closed = false );
+
 
     /**
        Function that extracts a n-1 digital surface (specified by a
@@ -777,6 +829,44 @@ namespace DGtal
                          const Point & aLowerBound, 
                          const Point & aUpperBound  );
     
+    /**
+       Computes the signed surfels whose elements represents all the
+       boundary elements of a digital shape described by the predicate
+       [pp], exactly as sMakeBoundary, but without any tracking. The
+       bounding box is cut into slabs along the last axis, which are
+       scanned independently (in parallel when DGtal is built with
+       OpenMP). The output is sorted, so that it does not depend on
+       the number of slabs.
+
+       @note The predicate @a pp is called concurrently by several
+       threads and must be thread-safe for const accesses.
+
+       @tparam PointPredicate a model of concepts::CPointPredicate describing
+       the inside of a digital shape, meaning a functor taking a Point
+       and returning 'true' whenever the point belongs to the shape.
+
+       @param aBoundary (modified) the sorted vector of bels.
+
+       @param aKSpace any space.
+
+       @param pp an instance of a model of concepts::CPointPredicate, for
+       instance a SetPredicate for a digital set representing a shape.
+
+       @param aLowerBound and @param aUpperBound points giving the
+       bounds of the extracted boundary.
+
+       @param nbSlabs the number of slabs, or 0 to choose it from the
+       number of available threads (default).
+    */
+    template <typename PointPredicate >
+    static
+    void sParallelMakeBoundary( std::vector<SCell> & aBoundary,
+                                const KSpace & aKSpace,
+                                const PointPredicate & pp,
+                                const Point & aLowerBound,
+                                const Point & aUpperBound,
+                                unsigned int nbSlabs = 0 );
+
 
     
 
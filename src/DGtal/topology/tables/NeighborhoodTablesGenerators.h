@@ -83,6 +83,8 @@ namespace DGtal {
     Domain domain( p1, p2 );
     DigitalSet shapeSet( domain );
     TObject shape( dt, shapeSet );
+    // The tables are computed from the geodesic neighborhoods.
+    shape.unsetTable();
     unsigned int k = 0;
     for ( DomainConstIterator it = domain.begin(); it != domain.end(); ++it )
       if ( *it != c ) ++k;
@@ -0,0 +1,193 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testCheckedArithmetic.cpp
+ * @ingroup Tests
+ *
+ * @author DGtal development team (\c dgtal-devel@lists.gforge.liris.cnrs.fr )
+ *
+ * @date 2026/10/19
+ *
+ * Functions for testing the overflow-checked arithmetic and the
+ * 128-bit integers.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <cstdlib>
+#include <iostream>
+#include <sstream>
+#include "DGtal/base/Common.h"
+#include "DGtal/kernel/CInteger.h"
+#include "DGtal/kernel/NumberTraits.h"
+#include "DGtal/arithmetic/CheckedArithmetic.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing the checked arithmetic.
+///////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @return a random integer of about @a bits bits, possibly negative.
+ */
+DGtal::int64_t randomInteger( unsigned int bits )
+{
+  const DGtal::int64_t r = ( static_cast<DGtal::int64_t>( rand() ) << 31 ) ^ rand();
+  const DGtal::int64_t v = r & ( ( DGtal::int64_t( 1 ) << bits ) - 1 );
+  return ( rand() % 2 == 0 ) ? v : -v;
+}
+
+#ifdef WITH_INT128
+/**
+ * Checks NumberTraits and the stream output of the 128-bit integers.
+ */
+bool testInt128()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+  trace.beginBlock ( "128-bit integers..." );
+  BOOST_CONCEPT_ASSERT(( concepts::CInteger<DGtal::int128_t> ));
+  typedef NumberTraits<DGtal::int128_t> NT;
+  trace.info() << "  - max int128 = " << NT::max() << std::endl;
+  trace.info() << "  - min int128 = " << NT::min() << std::endl;
+  nbok += ( NT::digits() == 127 ) ? 1 : 0;
+  nb++;
+  nbok += ( NT::isSigned() == SIGNED ) && ( NumberTraits<DGtal::uint128_t>::isSigned() == UNSIGNED ) ? 1 : 0;
+  nb++;
+  std::ostringstream s1, s2, s3;
+  s1 << NT::min();
+  s2 << DGtal::int128_t( -1234567 ) * DGtal::int128_t( 1000000000000LL );
+  s3 << NumberTraits<DGtal::uint128_t>::max();
+  nbok += ( s1.str() == "-170141183460469231731687303715884105728" ) ? 1 : 0;
+  nb++;
+  nbok += ( s2.str() == "-1234567000000000000" ) ? 1 : 0;
+  nb++;
+  nbok += ( s3.str() == "340282366920938463463374607431768211455" ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") " << s1.str() << " " << s2.str()
+               << " " << s3.str() << std::endl;
+  trace.endBlock();
+  return nbok == nb;
+}
+
+/**
+ * Compares the checked operations on 64-bit integers with the
+ * operations on 128-bit integers.
+ */
+bool testCheckedOperations()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+  trace.beginBlock ( "Checked operations..." );
+  typedef DGtal::int64_t Integer;
+  typedef DGtal::int128_t Wide;
+  const Wide max = NumberTraits<Integer>::max();
+  const Wide min = NumberTraits<Integer>::min();
+  for ( unsigned int i = 0; i < 10000; ++i )
+    {
+      const Integer a = randomInteger( 20 + i % 43 );
+      const Integer b = randomInteger( 1 + ( 7 * i ) % 62 );
+      Integer r;
+      const Wide sum = Wide( a ) + Wide( b );
+      const bool okAdd = functions::checkedAdd( a, b, r );
+      nbok += ( okAdd == ( sum <= max && sum >= min ) && ( ! okAdd || Wide( r ) == sum ) ) ? 1 : 0;
+      const Wide diff = Wide( a ) - Wide( b );
+      const bool okSub = functions::checkedSubtract( a, b, r );
+      nbok += ( okSub == ( diff <= max && diff >= min ) && ( ! okSub || Wide( r ) == diff ) ) ? 1 : 0;
+      const Wide prod = Wide( a ) * Wide( b );
+      const bool okMul = functions::checkedMultiply( a, b, r );
+      nbok += ( okMul == ( prod <= max && prod >= min ) && ( ! okMul || Wide( r ) == prod ) ) ? 1 : 0;
+      nb += 3;
+    }
+  Integer r;
+  nbok += ! functions::checkedSubtract( Integer( 0 ), NumberTraits<Integer>::min(), r ) ? 1 : 0;
+  nbok += ! functions::checkedMultiply( Integer( -1 ), NumberTraits<Integer>::min(), r ) ? 1 : 0;
+  nbok += functions::checkedAdd( Integer( -1 ), NumberTraits<Integer>::min() + 1, r )
+    && r == NumberTraits<Integer>::min() ? 1 : 0;
+  nb += 3;
+  trace.info() << "(" << nbok << "/" << nb << ") " << std::endl;
+  trace.endBlock();
+  return nbok == nb;
+}
+
+/**
+ * Checks the determinant signs computed with 64-bit integers,
+ * escalated to 128-bit integers on overflow.
+ */
+bool testDeterminantSigns()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+  unsigned int nbOverflows = 0;
+  trace.beginBlock ( "Determinant signs..." );
+  typedef DGtal::int64_t Integer;
+  typedef DGtal::int128_t Wide;
+  for ( unsigned int i = 0; i < 10000; ++i )
+    {
+      const unsigned int bits = 1 + i % 31;
+      Integer m[ 3 ][ 3 ];
+      Wide w[ 3 ][ 3 ];
+      for ( int j = 0; j < 3; ++j )
+        for ( int k = 0; k < 3; ++k )
+          w[ j ][ k ] = m[ j ][ k ] = randomInteger( bits );
+      // one singular matrix over two.
+      if ( i % 2 == 0 )
+        for ( int k = 0; k < 3; ++k )
+          w[ 2 ][ k ] = m[ 2 ][ k ] = m[ 0 ][ k ] - m[ 1 ][ k ];
+      const Wide d2 = w[ 0 ][ 0 ] * w[ 1 ][ 1 ] - w[ 0 ][ 1 ] * w[ 1 ][ 0 ];
+      nbok += ( functions::determinantSign2x2<Wide>( m[ 0 ][ 0 ], m[ 0 ][ 1 ], m[ 1 ][ 0 ], m[ 1 ][ 1 ] )
+                == ( d2 > 0 ) - ( d2 < 0 ) ) ? 1 : 0;
+      const Wide d3 = w[ 0 ][ 0 ] * ( w[ 1 ][ 1 ] * w[ 2 ][ 2 ] - w[ 1 ][ 2 ] * w[ 2 ][ 1 ] )
+        - w[ 0 ][ 1 ] * ( w[ 1 ][ 0 ] * w[ 2 ][ 2 ] - w[ 1 ][ 2 ] * w[ 2 ][ 0 ] )
+        + w[ 0 ][ 2 ] * ( w[ 1 ][ 0 ] * w[ 2 ][ 1 ] - w[ 1 ][ 1 ] * w[ 2 ][ 0 ] );
+      nbok += ( functions::determinantSign3x3<Wide>( m ) == ( d3 > 0 ) - ( d3 < 0 ) ) ? 1 : 0;
+      nb += 2;
+      Integer r;
+      nbOverflows += functions::checkedDeterminant3x3( m, r ) ? 0 : 1;
+    }
+  trace.info() << "(" << nbok << "/" << nb << ") " << nbOverflows
+               << " escalations" << std::endl;
+  trace.endBlock();
+  return ( nbok == nb ) && ( nbOverflows > 0 );
+}
+#endif
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc, char** argv )
+{
+  trace.beginBlock ( "Testing checked arithmetic" );
+  trace.info() << "Args:";
+  for ( int i = 0; i < argc; ++i )
+    trace.info() << " " << argv[ i ];
+  trace.info() << endl;
+
+  bool res = true;
+#ifdef WITH_INT128
+  res = testInt128() && testCheckedOperations() && testDeterminantSigns();
+#endif
+  trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
+  trace.endBlock();
+  return res ? 0 : 1;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
@@ -261,12 +261,12 @@ bool testValidBezout( const IntegerComputer<Integer> & ic )
  * Example of a test. To be completed.
  *
  */
+template <typename Integer>
 bool testIntegerComputer()
 {
   unsigned int nbtests = 50;
   unsigned int nbok = 0;
   unsigned int nb = 0;
-  typedef BigInteger Integer;
   IntegerComputer<Integer> ic;
   trace.beginBlock ( "Testing block: multiple random gcd." );
   for ( unsigned int i = 0; i < nbtests; ++i )
@@ -331,7 +331,13 @@ bool testIntegerComputer()
 int main( int /*argc*/, char** /*argv*/ )
 {
   trace.beginBlock ( "Testing class IntegerComputer" );
-  bool res = testIntegerComputer(); // && ... other tests
+  bool res = true;
+#ifdef WITH_BIGINTEGER
+  res = res && testIntegerComputer<BigInteger>();
+#endif
+#ifdef WITH_INT128
+  res = res && testIntegerComputer<DGtal::int128_t>();
+#endif
   trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
   trace.endBlock();
   return res ? 0 : 1;
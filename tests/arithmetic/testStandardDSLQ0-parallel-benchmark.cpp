@@ -0,0 +1,170 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+
+/**
+ * @file testStandardDSLQ0-parallel-benchmark.cpp
+ * @ingroup Tests
+ *
+ * @author DGtal development team (\c dgtal-devel@lists.gforge.liris.cnrs.fr )
+ *
+ * @date 2026/10/19
+ *
+ * Multi-threaded benchmark of StandardDSLQ0::reversedSmartDSS with
+ * the three Stern-Brocot trees, which are shared by all the threads.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+#ifdef WITH_OPENMP
+#include <omp.h>
+#endif
+#include "DGtal/base/Common.h"
+#include "DGtal/base/Clock.h"
+#include "DGtal/arithmetic/IntegerComputer.h"
+#include "DGtal/arithmetic/SternBrocot.h"
+#include "DGtal/arithmetic/LightSternBrocot.h"
+#include "DGtal/arithmetic/LighterSternBrocot.h"
+#include "DGtal/arithmetic/StandardDSLQ0.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for benchmarking the Stern-Brocot trees with several threads.
+///////////////////////////////////////////////////////////////////////////////
+
+/// A digital straight line and a subsegment given by two abscissas.
+struct Sample
+{
+  DGtal::int64_t a, b, mu, x1, x2;
+};
+
+/**
+ * Draws the samples beforehand, since rand() is not thread-safe.
+ */
+std::vector<Sample> makeSamples( unsigned int nbtries, DGtal::int64_t modb,
+                                 DGtal::int64_t modx )
+{
+  IntegerComputer<DGtal::int64_t> ic;
+  std::vector<Sample> samples;
+  while ( samples.size() < nbtries )
+    {
+      Sample s;
+      s.b = rand() % modb + 1;
+      s.a = rand() % s.b + 1;
+      if ( ic.gcd( s.a, s.b ) != 1 ) continue;
+      s.mu = rand() % ( 2 * modb );
+      s.x1 = rand() % modx;
+      s.x2 = s.x1 + 1 + ( rand() % modx );
+      samples.push_back( s );
+    }
+  return samples;
+}
+
+/**
+ * Computes the subsegments of the samples with the given number of
+ * threads.
+ *
+ * @param samples the samples.
+ * @param nbThreads the number of threads.
+ * @param results (returns) the characteristics of each subsegment.
+ * @return the elapsed time in ms.
+ */
+template <typename Fraction>
+double computeSubsegments( const std::vector<Sample> & samples, int nbThreads,
+                           std::vector<DGtal::int64_t> & results )
+{
+  typedef StandardDSLQ0<Fraction> DSL;
+  typedef typename DSL::Point Point;
+  results.resize( 3 * samples.size() );
+  const long n = static_cast<long>( samples.size() );
+  Clock c;
+  c.startClock();
+#ifdef WITH_OPENMP
+#pragma omp parallel for schedule(dynamic,64) num_threads(nbThreads)
+#endif
+  for ( long i = 0; i < n; ++i )
+    {
+      const Sample & s = samples[ i ];
+      DSL D( s.a, s.b, s.mu );
+      Point A = D.lowestY( s.x1 );
+      Point B = D.lowestY( s.x2 );
+      DSL S = D.reversedSmartDSS( A, B );
+      results[ 3 * i ]     = NumberTraits<typename DSL::Integer>::castToInt64_t( S.a() );
+      results[ 3 * i + 1 ] = NumberTraits<typename DSL::Integer>::castToInt64_t( S.b() );
+      results[ 3 * i + 2 ] = NumberTraits<typename DSL::Integer>::castToInt64_t( S.mu() );
+    }
+  boost::ignore_unused_variable_warning( nbThreads );
+  return c.stopClock();
+}
+
+/**
+ * Runs the benchmark for one Stern-Brocot tree, with 1 to
+ * maxThreads threads. Each run uses new samples so that the tree
+ * keeps growing, and is checked against a sequential computation.
+ *
+ * @return 'true' iff all the runs give the sequential results.
+ */
+template <typename SB>
+bool benchmark( const std::string & name, unsigned int nbtries,
+                DGtal::int64_t modb, DGtal::int64_t modx, int maxThreads )
+{
+  typedef typename SB::Fraction Fraction;
+  bool ok = true;
+  for ( int t = 1; t <= maxThreads; t *= 2 )
+    {
+      std::vector<Sample> samples = makeSamples( nbtries, modb, modx );
+      std::vector<DGtal::int64_t> results, expected;
+      const double time = computeSubsegments<Fraction>( samples, t, results );
+      computeSubsegments<Fraction>( samples, 1, expected );
+      ok = ok && ( results == expected );
+      std::cout << name << " " << t << " " << time
+                << " " << SB::instance().nbFractions
+                << ( results == expected ? "" : " ERROR" ) << std::endl;
+    }
+  return ok;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc, char** argv)
+{
+  typedef SternBrocot<DGtal::int64_t,DGtal::int32_t> SB;
+  typedef LightSternBrocot<DGtal::int64_t,DGtal::int32_t> LSB;
+  typedef LighterSternBrocot<DGtal::int64_t,DGtal::int32_t> LrSB;
+  unsigned int nbtries = ( argc > 1 ) ? atoi( argv[ 1 ] ) : 100000;
+  DGtal::int64_t modb = ( argc > 2 ) ? atoll( argv[ 2 ] ) : 1000000000000LL;
+  DGtal::int64_t modx = ( argc > 3 ) ? atoll( argv[ 3 ] ) : 1000;
+#ifdef WITH_OPENMP
+  int maxThreads = ( argc > 4 ) ? atoi( argv[ 4 ] ) : omp_get_max_threads();
+#else
+  int maxThreads = 1;
+#endif
+  std::cout << "# tree threads time(ms) nbFractions" << std::endl;
+  bool ok = benchmark<SB>( "SB", nbtries, modb, modx, maxThreads )
+    && benchmark<LSB>( "LSB", nbtries, modb, modx, maxThreads )
+    && benchmark<LrSB>( "LrSB", nbtries, modb, modx, maxThreads );
+  return ok ? 0 : 1;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,119 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+
+/**
+ * @file testObjectPool.cpp
+ * @ingroup Tests
+ *
+ * @author DGtal development team (\c dgtal-devel@lists.gforge.liris.cnrs.fr )
+ *
+ * @date 2026/10/19
+ *
+ * Functions for testing class ObjectPool.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <string>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/ObjectPool.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class ObjectPool.
+///////////////////////////////////////////////////////////////////////////////
+
+/// Counts its living instances, and is neither copyable nor movable.
+struct Counted
+{
+  static int nbAlive;
+  Counted( int aValue, const std::string & aName, Counted* aNext )
+    : value( aValue ), name( aName ), next( aNext )
+  { ++nbAlive; }
+  ~Counted() { --nbAlive; }
+  int value;
+  std::string name;
+  Counted* next;
+private:
+  Counted( const Counted & );
+  Counted & operator=( const Counted & );
+};
+int Counted::nbAlive = 0;
+
+/**
+ * Creates objects in a pool, checks that they keep their address and
+ * value, and that they are all destroyed with the pool.
+ */
+bool testObjectPool()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+  trace.beginBlock ( "Testing ObjectPool ..." );
+  {
+    ObjectPool<Counted> pool( 10 );
+    std::vector<Counted*> objects;
+    Counted* last = 0;
+    for ( int i = 0; i < 95; ++i )
+      {
+        last = pool.create( i, "object", last );
+        objects.push_back( last );
+      }
+    trace.info() << pool << std::endl;
+    nbok += ( pool.size() == 95 ) && ( pool.nbBlocks() == 10 ) ? 1 : 0;
+    nb++;
+    nbok += ( Counted::nbAlive == 95 ) ? 1 : 0;
+    nb++;
+    bool ok = true;
+    for ( int i = 0; i < 95; ++i )
+      ok = ok && ( objects[ i ]->value == i )
+        && ( objects[ i ]->next == ( i == 0 ? 0 : objects[ i - 1 ] ) );
+    nbok += ok ? 1 : 0;
+    nb++;
+    nbok += pool.isValid() ? 1 : 0;
+    nb++;
+  }
+  nbok += ( Counted::nbAlive == 0 ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") " << std::endl;
+  trace.endBlock();
+  return nbok == nb;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc, char** argv )
+{
+  trace.beginBlock ( "Testing class ObjectPool" );
+  trace.info() << "Args:";
+  for ( int i = 0; i < argc; ++i )
+    trace.info() << " " << argv[ i ];
+  trace.info() << endl;
+
+  bool res = testObjectPool();
+  trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
+  trace.endBlock();
+  return res ? 0 : 1;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
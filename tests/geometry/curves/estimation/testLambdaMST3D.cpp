@@ -99,6 +99,56 @@ public:
     return true;
   }
 
+  bool lambda64Consistency()
+  {
+    Segmentation segmenter ( curve.begin(), curve.end(), SegmentComputer() );
+    LambdaMST3D < Segmentation > lmst64;
+    lmst64.attach ( segmenter );
+    lmst64.init ( curve.begin(), curve.end() );
+    vector < RealVector > tangent;
+    lmst64.eval < back_insert_iterator< vector < RealVector > > > ( curve.begin(), curve.end(), back_insert_iterator< vector < RealVector > > ( tangent ) );
+    if ( tangent.size() != curve.size() )
+      return false;
+    // the tangents of the whole curve are the ones of each point, up to orientation
+    unsigned int i = 0;
+    for ( ConstIterator it = curve.begin(); it != curve.end(); ++it, ++i )
+    {
+      RealVector t = lmst64.eval ( *it );
+      if ( std::abs ( std::abs ( t.dot ( tangent[ i ] ) ) - t.norm() * tangent[ i ].norm() ) > 1e-10 )
+        return false;
+    }
+    return true;
+  }
+
+  bool lambda64BackTracking()
+  {
+    // a digital straight segment followed by the same points in reverse order
+    Range backTracking;
+    for ( int i = 0; i <= 20; ++i )
+      backTracking.push_back ( Point ( i, i / 2, i / 3 ) );
+    for ( int i = 19; i >= 0; --i )
+      backTracking.push_back ( Point ( i, i / 2, i / 3 ) );
+    Segmentation segmenter ( backTracking.begin(), backTracking.end(), SegmentComputer() );
+    LambdaMST3D < Segmentation > lmst64;
+    lmst64.attach ( segmenter );
+    lmst64.init ( backTracking.begin(), backTracking.end() );
+    vector < RealVector > tangent;
+    lmst64.eval < back_insert_iterator< vector < RealVector > > > ( backTracking.begin(), backTracking.end(), back_insert_iterator< vector < RealVector > > ( tangent ) );
+    if ( tangent.size() != backTracking.size() )
+      return false;
+    // each visit of a point is estimated from the DSSs covering this visit only:
+    // both visits get a tangent, parallel to the segment
+    const RealVector direction = RealVector ( 6., 3., 2. ) / 7.;
+    for ( unsigned int i = 0; i < tangent.size(); ++i )
+    {
+      if ( tangent[ i ].norm() == 0. )
+        return false;
+      if ( std::abs ( std::abs ( direction.dot ( tangent[ i ] ) ) - tangent[ i ].norm() ) > 1e-10 )
+        return false;
+    }
+    return true;
+  }
+
   bool lambda64Filtered()
   {
       Segmentation segmenter ( curve.begin(), curve.end(), SegmentComputer() );
@@ -173,6 +223,8 @@ int main( int , char**  )
         trace.endBlock();
         trace.beginBlock ( "Testing calculation for whole curve" );
            res &= testLMST.lambda64();
+           res &= testLMST.lambda64Consistency();
+           res &= testLMST.lambda64BackTracking();
            res &= testLMST.lambdaSin();
            res &= testLMST.lambdaExp();
         trace.endBlock();
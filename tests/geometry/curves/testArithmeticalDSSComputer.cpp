@@ -424,6 +424,54 @@ bool testBIGINTEGER()
 
 #endif
 
+#ifdef WITH_INT128
+/**
+ * Test for 4-connected points
+ * with 64-bit coordinates whose remainders
+ * only fit in 128-bit integers
+ */
+bool testINT128()
+{
+  typedef DGtal::int64_t Coordinate;
+  typedef DGtal::int128_t Integer;
+  typedef PointVector<2,Coordinate> Point;
+  typedef std::vector<Point>::iterator Iterator;
+  typedef ArithmeticalDSSComputer<Iterator,Integer,4> DSS4;
+
+  trace.beginBlock("Add some points of 64-bit coordinates");
+
+  const Coordinate b = 4000000000000000000LL;
+  std::vector<Point> contour;
+  contour.push_back(Point(b,b));
+  contour.push_back(Point(b+1,b));
+  contour.push_back(Point(b+2,b));
+  contour.push_back(Point(b+3,b));
+  contour.push_back(Point(b+3,b+1));
+  contour.push_back(Point(b+4,b+1));
+  contour.push_back(Point(b+5,b+1));
+  contour.push_back(Point(b+5,b+2));
+
+  DSS4 theDSS4;
+  theDSS4.init( contour.begin() );
+  while ( (theDSS4.end() != contour.end())
+          &&(theDSS4.extendFront()) ) {}
+
+  trace.info() << theDSS4 << " " << theDSS4.isValid() << std::endl;
+
+  const Integer mu = Integer( -3 ) * Integer( b );
+  bool flag = ( theDSS4.end() == contour.end() )
+    && theDSS4.isValid()
+    && (theDSS4.a() == 2)
+    && (theDSS4.b() == 5)
+    && (theDSS4.mu() == mu)
+    && (theDSS4.omega() == 7);
+
+  trace.endBlock();
+
+  return flag;
+}
+#endif
+
 /**
  * Test for corners
  * in 8-connected curves
@@ -487,6 +535,9 @@ int main(int argc, char **argv)
     && testCorner()
 #ifdef WITH_BIGINTEGER
     && testBIGINTEGER()
+#endif
+#ifdef WITH_INT128
+    && testINT128()
 #endif
     && testIsInside()
     ;
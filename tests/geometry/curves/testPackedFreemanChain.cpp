@@ -0,0 +1,176 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testPackedFreemanChain.cpp
+ * @ingroup Tests
+ *
+ * @author DGtal development team (\c dgtal-devel@lists.gforge.liris.cnrs.fr )
+ *
+ * @date 2026/10/19
+ *
+ * Functions for testing class PackedFreemanChain.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <vector>
+#include <iterator>
+
+#include "DGtalCatch.h"
+#include "ConfigTest.h"
+#include "DGtal/base/Common.h"
+#include "DGtal/geometry/curves/FreemanChain.h"
+#include "DGtal/geometry/curves/PackedFreemanChain.h"
+#include "DGtal/geometry/curves/ArithmeticalDSSComputer.h"
+#include "DGtal/geometry/curves/GreedySegmentation.h"
+#include "DGtal/geometry/curves/FP.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+typedef FreemanChain<int> FC;
+typedef PackedFreemanChain<int> PFC;
+
+TEST_CASE( "Packing of a Freeman chain" )
+{
+  std::string filename = testPath + "samples/BigBall2.fc";
+  std::fstream fst( filename.c_str(), std::ios::in );
+  FC fc( fst );
+  PFC pfc( fc );
+
+  SECTION( "Codes and extremities" )
+    {
+      REQUIRE( pfc.isValid() );
+      REQUIRE( pfc.size() == fc.size() );
+      REQUIRE( pfc.firstPoint() == fc.firstPoint() );
+      REQUIRE( pfc.lastPoint() == fc.lastPoint() );
+      bool same = true;
+      for ( unsigned int i = 0; i < fc.size(); ++i )
+        same = same && ( pfc.code( i ) == fc.code( i ) );
+      REQUIRE( same );
+      REQUIRE( pfc.unpack() == fc );
+      REQUIRE( pfc.memoryFootprint() < fc.chain.size() / 2 );
+    }
+
+  SECTION( "Iteration" )
+    {
+      std::vector<FC::Point> points( fc.begin(), fc.end() );
+      std::vector<PFC::Point> packedPoints( pfc.begin(), pfc.end() );
+      REQUIRE( points == packedPoints );
+
+      std::vector<PFC::Point> backward;
+      PFC::ConstIterator it = pfc.end();
+      do
+        {
+          --it;
+          backward.push_back( *it );
+        }
+      while ( it != pfc.begin() );
+      REQUIRE( std::equal( backward.rbegin(), backward.rend(), points.begin() ) );
+    }
+
+  SECTION( "Random access" )
+    {
+      std::vector<FC::Point> points( fc.begin(), fc.end() );
+      bool same = true;
+      for ( unsigned int i = 0; i <= fc.size(); i += 97 )
+        same = same && ( pfc.getPoint( i ) == points[ i ] )
+          && ( *PFC::ConstIterator( pfc, i ) == points[ i ] );
+      REQUIRE( same );
+      REQUIRE( pfc.getPoint( pfc.size() ) == points.back() );
+      REQUIRE( pfc.getPoint( PFC::checkpointStep ) == points[ PFC::checkpointStep ] );
+      REQUIRE( pfc.getPoint( PFC::checkpointStep - 1 ) == points[ PFC::checkpointStep - 1 ] );
+    }
+
+  SECTION( "Bulk decoding" )
+    {
+      std::vector<FC::Point> points( fc.begin(), fc.end() );
+      std::vector<PFC::Point> decoded;
+      pfc.getPoints( 0, pfc.size() + 1, std::back_inserter( decoded ) );
+      REQUIRE( decoded == points );
+
+      bool same = true;
+      const unsigned int starts[] = { 1, 2, 3, 4, 1023, 1024, 5001 };
+      const unsigned int lengths[] = { 0, 1, 2, 3, 4, 5, 9, 100 };
+      for ( unsigned int s = 0; s < 7; ++s )
+        for ( unsigned int l = 0; l < 8; ++l )
+          {
+            decoded.clear();
+            pfc.getPoints( starts[ s ], lengths[ l ], std::back_inserter( decoded ) );
+            same = same && ( decoded.size() == lengths[ l ] )
+              && std::equal( decoded.begin(), decoded.end(), points.begin() + starts[ s ] );
+          }
+      REQUIRE( same );
+    }
+
+  SECTION( "Streaming input/output" )
+    {
+      std::stringstream ss;
+      PFC::write( ss, pfc );
+      PFC pfc2( ss );
+      REQUIRE( pfc2 == pfc );
+
+      std::fstream fst2( filename.c_str(), std::ios::in );
+      PFC pfc3( fst2 );
+      REQUIRE( pfc3 == pfc );
+    }
+}
+
+TEST_CASE( "Packed Freeman chain as a range of points" )
+{
+  std::string filename = testPath + "samples/manche.fc";
+  std::fstream fst( filename.c_str(), std::ios::in );
+  FC fc( fst );
+  PFC pfc( fc );
+
+  SECTION( "Greedy segmentation" )
+    {
+      typedef ArithmeticalDSSComputer<FC::ConstIterator, int, 4> DSSComputer;
+      typedef ArithmeticalDSSComputer<PFC::ConstIterator, int, 4> PackedDSSComputer;
+      typedef GreedySegmentation<DSSComputer> Segmentation;
+      typedef GreedySegmentation<PackedDSSComputer> PackedSegmentation;
+
+      Segmentation s( fc.begin(), fc.end(), DSSComputer() );
+      PackedSegmentation ps( pfc.begin(), pfc.end(), PackedDSSComputer() );
+      Segmentation::SegmentComputerIterator it = s.begin();
+      PackedSegmentation::SegmentComputerIterator pit = ps.begin();
+      unsigned int nb = 0, nbok = 0;
+      for ( ; ( it != s.end() ) && ( pit != ps.end() ); ++it, ++pit, ++nb )
+        nbok += ( it->primitive() == pit->primitive() ) ? 1 : 0;
+      REQUIRE( nb > 0 );
+      REQUIRE( nbok == nb );
+      REQUIRE( ( it == s.end() ) );
+      REQUIRE( ( pit == ps.end() ) );
+    }
+
+  SECTION( "Faithful polygon" )
+    {
+      typedef FP<FC::ConstIterator, int, 4> Polygon;
+      typedef FP<PFC::ConstIterator, int, 4> PackedPolygon;
+      Polygon fp( fc.begin(), fc.end() );
+      PackedPolygon pfp( pfc.begin(), pfc.end() );
+      std::vector<FC::Point> vertices, packedVertices;
+      fp.copyFP( std::back_inserter( vertices ) );
+      pfp.copyFP( std::back_inserter( packedVertices ) );
+      REQUIRE( vertices == packedVertices );
+    }
+}
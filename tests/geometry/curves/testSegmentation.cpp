@@ -225,7 +225,7 @@ bool greedySegmentationVisualTest()
      fc.begin(),fc.end(),
      "Truncate",aBoard);   
 
-  aBoard.saveEPS("WholeOpenCurveWithItMode1.eps");
+  aBoard.saveEPS( ( testOutputPath + "WholeOpenCurveWithItMode1.eps" ).c_str() );
 }
   trace.endBlock();
 
@@ -240,7 +240,7 @@ bool greedySegmentationVisualTest()
      fc.begin(),fc.end(),
      "DoNotTruncate",aBoard);   
 
-  aBoard.saveEPS("WholeOpenCurveWithItMode3.eps");
+  aBoard.saveEPS( ( testOutputPath + "WholeOpenCurveWithItMode3.eps" ).c_str() );
 }
   trace.endBlock();
 
@@ -254,7 +254,7 @@ bool greedySegmentationVisualTest()
      fc.begin(),fc.end(),
      "Truncate+1",aBoard);   
 
-  aBoard.saveEPS("WholeOpenCurveWithItMode2.eps");
+  aBoard.saveEPS( ( testOutputPath + "WholeOpenCurveWithItMode2.eps" ).c_str() );
 }
   trace.endBlock();
 
@@ -284,7 +284,7 @@ trace.info() << *start << " " << *stop << endl;
      start,stop,
      "Truncate",aBoard);   
 
-  aBoard.saveEPS("PartOpenCurveWithItMode1.eps");
+  aBoard.saveEPS( ( testOutputPath + "PartOpenCurveWithItMode1.eps" ).c_str() );
 }
   trace.endBlock();
 
@@ -299,7 +299,7 @@ trace.info() << *start << " " << *stop << endl;
      start,stop,
      "Truncate+1",aBoard);   
 
-  aBoard.saveEPS("PartOpenCurveWithItMode2.eps");
+  aBoard.saveEPS( ( testOutputPath + "PartOpenCurveWithItMode2.eps" ).c_str() );
 }
   trace.endBlock();
 
@@ -315,7 +315,7 @@ trace.info() << *start << " " << *stop << endl;
      start,stop,
      "DoNotTruncate",aBoard);   
 
-  aBoard.saveEPS("PartOpenCurveWithItMode3.eps");
+  aBoard.saveEPS( ( testOutputPath + "PartOpenCurveWithItMode3.eps" ).c_str() );
 }
   trace.endBlock();
 
@@ -335,7 +335,7 @@ trace.info() << *start << " " << *stop << endl;
     (c,c,c,c,
      "Truncate",aBoard);   
 
-  aBoard.saveEPS("WholeOpenCurveWithCircMode1.eps");
+  aBoard.saveEPS( ( testOutputPath + "WholeOpenCurveWithCircMode1.eps" ).c_str() );
 }
   trace.endBlock();
 
@@ -348,7 +348,7 @@ trace.info() << *start << " " << *stop << endl;
     (c,c,c,c,
      "Truncate+1",aBoard);   
 
-  aBoard.saveEPS("WholeOpenCurveWithCircMode2.eps");
+  aBoard.saveEPS( ( testOutputPath + "WholeOpenCurveWithCircMode2.eps" ).c_str() );
 }
   trace.endBlock();
 
@@ -362,7 +362,7 @@ trace.info() << *start << " " << *stop << endl;
     (c,c,c,c,
      "DoNotTruncate",aBoard);   
 
-  aBoard.saveEPS("WholeOpenCurveWithCircMode3.eps");
+  aBoard.saveEPS( ( testOutputPath + "WholeOpenCurveWithCircMode3.eps" ).c_str() );
 }
   trace.endBlock();
 
@@ -383,7 +383,7 @@ trace.info() << *start << " " << *stop << endl;
      cstart,cstop,
      "Truncate",aBoard);   
 
-  aBoard.saveEPS("PartOpenCurveWithCircMode1.eps");
+  aBoard.saveEPS( ( testOutputPath + "PartOpenCurveWithCircMode1.eps" ).c_str() );
 }
   trace.endBlock();
 
@@ -398,7 +398,7 @@ trace.info() << *start << " " << *stop << endl;
      cstart,cstop,
      "Truncate+1",aBoard);   
 
-  aBoard.saveEPS("PartOpenCurveWithCircMode2.eps");
+  aBoard.saveEPS( ( testOutputPath + "PartOpenCurveWithCircMode2.eps" ).c_str() );
 }
   trace.endBlock();
 
@@ -414,7 +414,7 @@ trace.info() << *start << " " << *stop << endl;
      cstart,cstop,
      "DoNotTruncate",aBoard);   
 
-  aBoard.saveEPS("PartOpenCurveWithCircMode3.eps");
+  aBoard.saveEPS( ( testOutputPath + "PartOpenCurveWithCircMode3.eps" ).c_str() );
 }
   trace.endBlock();
 
@@ -450,7 +450,7 @@ trace.info() << *start2 << " " << *stop2 << endl;
      start2,stop2,
      "Truncate",aBoard);   
 
-  aBoard.saveEPS("DuplicatedCurveWithItMode1.eps");
+  aBoard.saveEPS( ( testOutputPath + "DuplicatedCurveWithItMode1.eps" ).c_str() );
 }
   trace.endBlock();
 
@@ -465,7 +465,7 @@ trace.info() << *start2 << " " << *stop2 << endl;
      start2,stop2,
      "Truncate+1",aBoard);   
 
-  aBoard.saveEPS("DuplicatedCurveWithItMode2.eps");
+  aBoard.saveEPS( ( testOutputPath + "DuplicatedCurveWithItMode2.eps" ).c_str() );
 }
   trace.endBlock();
 
@@ -481,7 +481,7 @@ trace.info() << *start2 << " " << *stop2 << endl;
      start2,stop2,
      "DoNotTruncate",aBoard);   
 
-  aBoard.saveEPS("DuplicatedCurveWithItMode3.eps");
+  aBoard.saveEPS( ( testOutputPath + "DuplicatedCurveWithItMode3.eps" ).c_str() );
 }
   trace.endBlock();
 
@@ -500,7 +500,7 @@ trace.info() << *start2 << " " << *stop2 << endl;
     (c2,c2,c2,c2,
      "Truncate",aBoard);   
 
-  aBoard.saveEPS("ClosedCurveWithCircMode1.eps");
+  aBoard.saveEPS( ( testOutputPath + "ClosedCurveWithCircMode1.eps" ).c_str() );
 }
   trace.endBlock();
 
@@ -513,7 +513,7 @@ trace.info() << *start2 << " " << *stop2 << endl;
     (c2,c2,c2,c2,
      "Truncate+1",aBoard);   
 
-  aBoard.saveEPS("ClosedCurveWithCircMode2.eps");
+  aBoard.saveEPS( ( testOutputPath + "ClosedCurveWithCircMode2.eps" ).c_str() );
 }
   trace.endBlock();
 
@@ -527,7 +527,7 @@ trace.info() << *start2 << " " << *stop2 << endl;
     (c2,c2,c2,c2,
      "DoNotTruncate",aBoard);   
 
-  aBoard.saveEPS("ClosedCurveWithCircMode3.eps");
+  aBoard.saveEPS( ( testOutputPath + "ClosedCurveWithCircMode3.eps" ).c_str() );
 }
   trace.endBlock();
 
@@ -572,7 +572,7 @@ bool SaturatedSegmentationVisualTest()
      fc.begin(),fc.end(),
      "First",aBoard);   
 
-  aBoard.saveEPS("MSOpenCurve2.eps");
+  aBoard.saveEPS( ( testOutputPath + "MSOpenCurve2.eps" ).c_str() );
 }
   trace.endBlock();
 
@@ -586,7 +586,7 @@ bool SaturatedSegmentationVisualTest()
      fc.begin(),fc.end(),
      "MostCentered",aBoard);   
 
-  aBoard.saveEPS("MSOpenCurve3.eps");
+  aBoard.saveEPS( ( testOutputPath + "MSOpenCurve3.eps" ).c_str() );
 }
   trace.endBlock();
 
@@ -600,7 +600,7 @@ bool SaturatedSegmentationVisualTest()
      fc.begin(),fc.end(),
      "Last",aBoard);   
 
-  aBoard.saveEPS("MSOpenCurve4.eps");
+  aBoard.saveEPS( ( testOutputPath + "MSOpenCurve4.eps" ).c_str() );
 }
   trace.endBlock();
 
@@ -630,7 +630,7 @@ trace.info() << *start << " " << *stop << endl;
      start,stop,
      "First",aBoard);   
 
-  aBoard.saveEPS("MSOpenCurvePart2.eps");
+  aBoard.saveEPS( ( testOutputPath + "MSOpenCurvePart2.eps" ).c_str() );
 }
   trace.endBlock();
 
@@ -645,7 +645,7 @@ trace.info() << *start << " " << *stop << endl;
      start,stop,
      "MostCentered",aBoard);   
 
-  aBoard.saveEPS("MSOpenCurvePart3.eps");
+  aBoard.saveEPS( ( testOutputPath + "MSOpenCurvePart3.eps" ).c_str() );
 }
   trace.endBlock();
 
@@ -660,7 +660,7 @@ trace.info() << *start << " " << *stop << endl;
      start,stop,
      "Last",aBoard);   
 
-  aBoard.saveEPS("MSOpenCurvePart4.eps");
+  aBoard.saveEPS( ( testOutputPath + "MSOpenCurvePart4.eps" ).c_str() );
 }
   trace.endBlock();
 
@@ -681,7 +681,7 @@ trace.info() << *start << " " << *stop << endl;
     (c,c,c,c,
      "First",aBoard);   
 
-  aBoard.saveEPS("MSOpenCurveWithCirc2.eps");
+  aBoard.saveEPS( ( testOutputPath + "MSOpenCurveWithCirc2.eps" ).c_str() );
 }
   trace.endBlock();
 
@@ -694,7 +694,7 @@ trace.info() << *start << " " << *stop << endl;
     (c,c,c,c,
      "MostCentered",aBoard);   
 
-  aBoard.saveEPS("MSOpenCurveWithCirc3.eps");
+  aBoard.saveEPS( ( testOutputPath + "MSOpenCurveWithCirc3.eps" ).c_str() );
 }
   trace.endBlock();
 
@@ -707,7 +707,7 @@ trace.info() << *start << " " << *stop << endl;
     (c,c,c,c,
      "Last",aBoard);   
 
-  aBoard.saveEPS("MSOpenCurveWithCirc4.eps");
+  aBoard.saveEPS( ( testOutputPath + "MSOpenCurveWithCirc4.eps" ).c_str() );
 }
   trace.endBlock();
 
@@ -729,7 +729,7 @@ trace.info() << *start << " " << *stop << endl;
     (c,c,cstart,cstop,
      "First",aBoard);   
 
-  aBoard.saveEPS("MSOpenCurvePartWithCirc2.eps");
+  aBoard.saveEPS( ( testOutputPath + "MSOpenCurvePartWithCirc2.eps" ).c_str() );
 }
   trace.endBlock();
 
@@ -743,7 +743,7 @@ trace.info() << *start << " " << *stop << endl;
     (c,c,cstart,cstop,
      "MostCentered",aBoard);   
 
-  aBoard.saveEPS("MSOpenCurvePartWithCirc3.eps");
+  aBoard.saveEPS( ( testOutputPath + "MSOpenCurvePartWithCirc3.eps" ).c_str() );
 }
   trace.endBlock();
 
@@ -757,7 +757,7 @@ trace.info() << *start << " " << *stop << endl;
     (c,c,cstart,cstop,
      "Last",aBoard);   
 
-  aBoard.saveEPS("MSOpenCurvePartWithCirc4.eps");
+  aBoard.saveEPS( ( testOutputPath + "MSOpenCurvePartWithCirc4.eps" ).c_str() );
 }
   trace.endBlock();
 
@@ -791,7 +791,7 @@ trace.info() << *start << " " << *stop << endl;
      start2,stop2,
      "First",aBoard);   
 
-  aBoard.saveEPS("MSClosedCurveWithIt2.eps");
+  aBoard.saveEPS( ( testOutputPath + "MSClosedCurveWithIt2.eps" ).c_str() );
 }
   trace.endBlock();
 
@@ -806,7 +806,7 @@ trace.info() << *start << " " << *stop << endl;
      start2,stop2,
      "MostCentered",aBoard);   
 
-  aBoard.saveEPS("MSClosedCurveWithIt3.eps");
+  aBoard.saveEPS( ( testOutputPath + "MSClosedCurveWithIt3.eps" ).c_str() );
 }
   trace.endBlock();
 
@@ -822,7 +822,7 @@ trace.info() << *start << " " << *stop << endl;
      start2,stop2,
      "Last",aBoard);   
 
-  aBoard.saveEPS("MSClosedCurveWithIt4.eps");
+  aBoard.saveEPS( ( testOutputPath + "MSClosedCurveWithIt4.eps" ).c_str() );
 }
   trace.endBlock();
 
@@ -845,7 +845,7 @@ trace.info() << *start << " " << *stop << endl;
     (c2,c2,c2,c2,
      "First",aBoard);   
 
-  aBoard.saveEPS("MSClosedCurveWithCirc2.eps");
+  aBoard.saveEPS( ( testOutputPath + "MSClosedCurveWithCirc2.eps" ).c_str() );
 }
   trace.endBlock();
 
@@ -859,7 +859,7 @@ trace.info() << *start << " " << *stop << endl;
     (c2,c2,c2,c2,
      "MostCentered",aBoard);   
 
-  aBoard.saveEPS("MSClosedCurveWithCirc3.eps");
+  aBoard.saveEPS( ( testOutputPath + "MSClosedCurveWithCirc3.eps" ).c_str() );
 }
   trace.endBlock();
 
@@ -873,7 +873,7 @@ trace.info() << *start << " " << *stop << endl;
     (c2,c2,c2,c2,
      "Last",aBoard);   
 
-  aBoard.saveEPS("MSClosedCurveWithCirc4.eps");
+  aBoard.saveEPS( ( testOutputPath + "MSClosedCurveWithCirc4.eps" ).c_str() );
 }
   trace.endBlock();
 
@@ -935,6 +935,91 @@ bool SaturatedSegmentationTest()
   return (compteur == 4295);
 }
 
+/**
+ * Checks that the chunked computation of the maximal segments
+ * of a (sub)range gives the same segments as SegmentComputerIterator
+ */
+template <typename Iterator>
+bool sameMaximalSegments(const Iterator& itb, const Iterator& ite,
+                         const Iterator& sitb, const Iterator& site,
+                         const string& aMode, unsigned int nbChunks)
+{
+  typedef typename IteratorCirculatorTraits<Iterator>::Value::Coordinate Coordinate;
+  typedef ArithmeticalDSSComputer<Iterator,Coordinate,8> RecognitionAlgorithm;
+  typedef SaturatedSegmentation<RecognitionAlgorithm> Segmentation;
+
+  RecognitionAlgorithm algo;
+  Segmentation s(itb,ite,algo);
+  s.setSubRange(sitb,site);
+  s.setMode(aMode);
+
+  vector<RecognitionAlgorithm> segments = s.maximalSegments( nbChunks );
+
+  unsigned int k = 0;
+  for (typename Segmentation::SegmentComputerIterator i = s.begin(), end = s.end();
+       i != end; ++i, ++k)
+    {
+      if ( k >= segments.size() ) return false;
+      if ( ( i->begin() != segments[k].begin() )
+           || ( i->end() != segments[k].end() )
+           || ( i->primitive() != segments[k].primitive() ) )
+        return false;
+    }
+  return ( k == segments.size() );
+}
+
+/**
+ * Chunked computation of a saturated segmentation
+ */
+bool SaturatedSegmentationChunksTest()
+{
+  typedef int Coordinate;
+  typedef FreemanChain<Coordinate> FC;
+  typedef PointVector<2,Coordinate> Point;
+
+  std::string filename = testPath + "samples/manche.fc";
+
+  std::fstream fst;
+  fst.open (filename.c_str(), std::ios::in);
+  FC fc(fst);
+
+  typedef vector<Point> Curve;
+  typedef Curve::const_iterator RAConstIterator;
+  Curve vPts;
+  vPts.assign ( fc.begin(), fc.end() );
+  const RAConstIterator vBegin = vPts.begin();
+  const RAConstIterator vEnd = vPts.end();
+
+  trace.beginBlock("Chunked saturated segmentation");
+  unsigned int nb = 0;
+  unsigned int nbok = 0;
+  const string modes[] = { "First", "MostCentered", "Last",
+                           "First++", "MostCentered++", "Last++" };
+  const unsigned int chunks[] = { 1, 2, 3, 7, 64, 1000 };
+  for ( unsigned int m = 0; m < 6; ++m )
+    for ( unsigned int c = 0; c < 6; ++c )
+      {
+        //whole range with bidirectional iterators
+        nbok += sameMaximalSegments( fc.begin(), fc.end(), fc.begin(), fc.end(),
+                                     modes[m], chunks[c] ) ? 1 : 0;
+        nb++;
+        //whole range with random access iterators
+        nbok += sameMaximalSegments( vBegin, vEnd, vBegin, vEnd,
+                                     modes[m], chunks[c] ) ? 1 : 0;
+        nb++;
+        //subrange
+        RAConstIterator start = vBegin+190;
+        RAConstIterator stop = vBegin+400;
+        nbok += sameMaximalSegments( vBegin, vEnd, start, stop,
+                                     modes[m], chunks[c] ) ? 1 : 0;
+        nb++;
+      }
+  trace.info() << "(" << nbok << "/" << nb << ") " << std::endl;
+  trace.endBlock();
+
+  return (nbok == nb);
+}
+
 /////////////////////////////////////////////////////////////////////////
 //////////////// MAIN ///////////////////////////////////////////////////
 /////////////////////////////////////////////////////////////////////////
@@ -951,6 +1036,7 @@ int main(int argc, char **argv)
   bool res = greedySegmentationVisualTest()
 && SaturatedSegmentationVisualTest()
 && SaturatedSegmentationTest()
+&& SaturatedSegmentationChunksTest()
 ;
 
   trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
@@ -485,14 +485,20 @@ int main( int /*argc*/, char** /*argv*/ )
 {
   using namespace Z3i;
 
-  // Max diameter is ~20 for int32_t, ~500 for int64_t, any with BigInteger.
+  // Max diameter is ~20 for int32_t, ~500 for int64_t, ~500000 for int128_t,
+  // any with BigInteger.
   trace.beginBlock ( "Testing class COBANaivePlaneComputer" );
   bool res = true 
     && testCOBANaivePlaneComputer()
     && checkManyPlanes<COBANaivePlaneComputer<Z3, DGtal::int32_t> >( 20, 100, 200 )
     && checkManyPlanes<COBANaivePlaneComputer<Z3, DGtal::int64_t> >( 500, 100, 200 )
     && checkManyPlanes<COBANaivePlaneComputer<Z3, DGtal::BigInteger> >( 10000, 10, 200 )
-    && checkExtendWithManyPoints<COBAGenericNaivePlaneComputer<Z3, DGtal::int64_t> >( 100, 100, 200 );
+    && checkExtendWithManyPoints<COBAGenericNaivePlaneComputer<Z3, DGtal::int64_t> >( 100, 100, 200 )
+#ifdef WITH_INT128
+    && checkManyPlanes<COBANaivePlaneComputer<Z3, DGtal::int128_t> >( 10000, 10, 200 )
+    && checkExtendWithManyPoints<COBAGenericNaivePlaneComputer<Z3, DGtal::int128_t> >( 10000, 10, 200 )
+#endif
+    ;
 
   trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
   trace.endBlock();
@@ -159,5 +159,14 @@ int main( int /*argc*/, char** /*argv*/ )
   trace.info() << plane << std::endl;
   checkChordGenericStandardPlaneComputer( plane, 5, 20 );
 
-  return 0;
+  bool res = true;
+#ifdef WITH_INT128
+  typedef ChordGenericStandardPlaneComputer<Space, Point, DGtal::int128_t>
+    PlaneComputer128;
+  PlaneComputer128 plane128;
+  res = checkChordGenericStandardPlaneComputer( plane128, 5, 20 );
+  trace.emphase() << ( res ? "Passed." : "Error." ) << std::endl;
+#endif
+
+  return res ? 0 : 1;
 }
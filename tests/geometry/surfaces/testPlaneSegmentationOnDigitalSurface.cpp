@@ -0,0 +1,232 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testPlaneSegmentationOnDigitalSurface.cpp
+ * @ingroup Tests
+ *
+ * @author DGtal development team (\c dgtal-devel@lists.gforge.liris.cnrs.fr )
+ *
+ * @date 2026/10/19
+ *
+ * Functions for testing class PlaneSegmentationOnDigitalSurface.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <vector>
+#include <cmath>
+#include "DGtal/base/Common.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/topology/DigitalSurface.h"
+#include "DGtal/topology/DigitalSetBoundary.h"
+#include "DGtal/graph/BreadthFirstVisitor.h"
+#include "DGtal/geometry/surfaces/ChordGenericNaivePlaneComputer.h"
+#include "DGtal/geometry/surfaces/PlaneSegmentationOnDigitalSurface.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+using namespace Z3i;
+
+typedef DigitalSetBoundary<KSpace,DigitalSet> MyDigitalSurfaceContainer;
+typedef DigitalSurface<MyDigitalSurfaceContainer> MyDigitalSurface;
+typedef PlaneSegmentationOnDigitalSurface<MyDigitalSurface> Segmentation;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class PlaneSegmentationOnDigitalSurface.
+///////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @param set any digital set.
+ * @param ks (returns) the cellular space.
+ * @return the boundary of the set.
+ */
+MyDigitalSurface* makeSurface( const DigitalSet & set, KSpace & ks )
+{
+  ks.init( set.domain().lowerBound(), set.domain().upperBound(), true );
+  SurfelAdjacency<KSpace::dimension> surfAdj( true );
+  return new MyDigitalSurface( new MyDigitalSurfaceContainer( ks, set, surfAdj ) );
+}
+
+/**
+ * Size of the patch grown from a surfel, computed as in the example
+ * greedy-plane-segmentation-ex2.cpp.
+ */
+std::size_t referenceScore( const MyDigitalSurface & surf, const KSpace & ks,
+                            const Segmentation::PlaneComputer & prototype,
+                            const SCell & seed )
+{
+  typedef BreadthFirstVisitor<MyDigitalSurface> Visitor;
+  Segmentation::PlaneComputer plane( prototype );
+  plane.clear();
+  Visitor visitor( surf, seed );
+  while ( ! visitor.finished() )
+    {
+      const SCell v = visitor.current().first;
+      const Dimension axis = ks.sOrthDir( v );
+      if ( plane.extend( ks.sCoords( ks.sDirectIncident( v, axis ) ) ) )
+        visitor.expand();
+      else
+        visitor.ignore();
+    }
+  return plane.size();
+}
+
+/**
+ * Checks the consistency of the segmentation of the boundary of a
+ * digital set: all surfels are labelled, the planes are a partition
+ * of the surface, the normals point outward and the scores are the
+ * ones of the sequential computation (from the surfel itself, or from
+ * its score seed when patches are shared).
+ */
+bool testSegmentation( const DigitalSet & set, std::size_t expectedNbPlanes,
+                       bool sharePatches )
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+  KSpace ks;
+  MyDigitalSurface* surf = makeSurface( set, ks );
+  Segmentation::PlaneComputer prototype;
+  prototype.init( 1, 1 );
+  Segmentation segmentation( *surf );
+  segmentation.compute( prototype, sharePatches );
+  trace.info() << segmentation << endl;
+  nbok += ( segmentation.size() == surf->size() ) ? 1 : 0;
+  nb++;
+  nbok += ( expectedNbPlanes == 0 || segmentation.nbPlanes() == expectedNbPlanes ) ? 1 : 0;
+  nb++;
+
+  std::vector<std::size_t> sizes( segmentation.nbPlanes(), 0 );
+  bool labelsOk = true;
+  bool normalsOk = true;
+  for ( Segmentation::Index i = 0; i < segmentation.size(); ++i )
+    {
+      const SCell & s = segmentation.surfels()[ i ];
+      labelsOk = labelsOk && ( segmentation.index( s ) == i )
+        && ( segmentation.label( i ) < segmentation.nbPlanes() );
+      if ( ! labelsOk ) break;
+      sizes[ segmentation.label( i ) ]++;
+      const Dimension k = ks.sOrthDir( s );
+      const RealVector n = segmentation.normal( i );
+      const double trivial = ks.sDirect( s, k ) ? -1.0 : 1.0;
+      normalsOk = normalsOk && ( n[ k ] * trivial >= 0.0 )
+        && ( std::fabs( n.norm() - 1.0 ) < 1e-10 );
+    }
+  nbok += labelsOk ? 1 : 0;
+  nb++;
+  nbok += normalsOk ? 1 : 0;
+  nb++;
+  bool sizesOk = labelsOk;
+  for ( Segmentation::Label l = 0; sizesOk && l < segmentation.nbPlanes(); ++l )
+    sizesOk = ( sizes[ l ] == segmentation.planeSize( l ) );
+  nbok += sizesOk ? 1 : 0;
+  nb++;
+  bool scoresOk = true;
+  for ( Segmentation::Index i = 0; i < segmentation.size(); i += 7 )
+    {
+      const Segmentation::Index seed = segmentation.scoreSeed( i );
+      scoresOk = scoresOk && ( sharePatches || seed == i )
+        && ( segmentation.score( i )
+             == referenceScore( *surf, ks, prototype, segmentation.surfels()[ seed ] ) );
+    }
+  nbok += scoresOk ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "labels=" << labelsOk << " normals=" << normalsOk
+               << " sizes=" << sizesOk << " scores=" << scoresOk << endl;
+  delete surf;
+  return nbok == nb;
+}
+
+/**
+ * Segmentation of the boundary of a cube.
+ */
+bool testCube()
+{
+  trace.beginBlock ( "Segmentation of a cube..." );
+  Domain domain( Point( -8, -8, -8 ), Point( 8, 8, 8 ) );
+  DigitalSet set( domain );
+  for ( Domain::ConstIterator it = domain.begin(), itE = domain.end(); it != itE; ++it )
+    if ( (*it).normInfinity() <= 5 ) set.insertNew( *it );
+  const bool res = testSegmentation( set, 6, false )
+    && testSegmentation( set, 6, true );
+  trace.endBlock();
+  return res;
+}
+
+/**
+ * Segmentation of the boundary of a ball.
+ */
+bool testBall()
+{
+  trace.beginBlock ( "Segmentation of a ball..." );
+  Domain domain( Point( -12, -12, -12 ), Point( 12, 12, 12 ) );
+  DigitalSet set( domain );
+  for ( Domain::ConstIterator it = domain.begin(), itE = domain.end(); it != itE; ++it )
+    if ( (*it).squaredNorm() <= 100 ) set.insertNew( *it );
+  const bool res = testSegmentation( set, 0, false )
+    && testSegmentation( set, 0, true );
+  trace.endBlock();
+  return res;
+}
+
+/**
+ * Segmentation of the boundary of a non-convex union of balls, where
+ * the patch grown from the score seed of a surfel in the second pass
+ * may not reach this surfel any more.
+ */
+bool testUnionOfBalls()
+{
+  trace.beginBlock ( "Segmentation of a union of balls..." );
+  Domain domain( Point( -16, -16, -16 ), Point( 16, 16, 16 ) );
+  DigitalSet set( domain );
+  const Point centers[ 4 ] = { Point( -5, 0, 0 ), Point( 5, 0, 0 ),
+                               Point( 0, 6, 3 ), Point( 1, -4, -7 ) };
+  const Point::Component radii[ 4 ] = { 8, 7, 6, 5 };
+  for ( Domain::ConstIterator it = domain.begin(), itE = domain.end(); it != itE; ++it )
+    for ( unsigned int j = 0; j < 4; ++j )
+      if ( ( *it - centers[ j ] ).squaredNorm() <= radii[ j ] * radii[ j ] )
+        {
+          set.insertNew( *it );
+          break;
+        }
+  const bool res = testSegmentation( set, 0, false )
+    && testSegmentation( set, 0, true );
+  trace.endBlock();
+  return res;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc, char** argv )
+{
+  trace.beginBlock ( "Testing class PlaneSegmentationOnDigitalSurface" );
+  trace.info() << "Args:";
+  for ( int i = 0; i < argc; ++i )
+    trace.info() << " " << argv[ i ];
+  trace.info() << endl;
+
+  bool res = testCube() && testBall() && testUnionOfBalls();
+  trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
+  trace.endBlock();
+  return res ? 0 : 1;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,178 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testFilteredDetPredicates-benchmark.cpp
+ * @ingroup Tests
+ *
+ * @author DGtal development team (\c dgtal-devel@lists.gforge.liris.cnrs.fr )
+ *
+ * @date 2026/10/19
+ *
+ * Benchmark of the 3d orientation and in-sphere tests of
+ * InHalfSpaceByFilteredDet and InBallByFilteredDet against the
+ * evaluation of the determinants with SimpleMatrix.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <cstdlib>
+#include <ctime>
+#include <vector>
+
+#include "DGtal/base/Common.h"
+#include "DGtal/kernel/PointVector.h"
+#include "DGtal/math/linalg/SimpleMatrix.h"
+#include "DGtal/geometry/tools/determinant/InHalfSpaceByFilteredDet.h"
+#include "DGtal/geometry/tools/determinant/InBallByFilteredDet.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+typedef PointVector<3, DGtal::int32_t> Point;
+
+/**
+ * Lifted in-sphere test with SimpleMatrix, as done without filter.
+ * @param p the four points of the sphere followed by the tested point
+ * @return the 5x5 determinant.
+ */
+template <typename Integer>
+Integer matrixInSphere( const Point* p )
+{
+  SimpleMatrix<Integer, 5, 5> m;
+  for ( int i = 0; i < 5; ++i )
+    {
+      Integer n = 0;
+      for ( int j = 0; j < 3; ++j )
+        {
+          m.setComponent( i, j, static_cast<Integer>( p[ i ][ j ] ) );
+          n += static_cast<Integer>( p[ i ][ j ] ) * static_cast<Integer>( p[ i ][ j ] );
+        }
+      m.setComponent( i, 3, n );
+      m.setComponent( i, 4, NumberTraits<Integer>::ONE );
+    }
+  return m.determinant();
+}
+
+/**
+ * Orientation test with SimpleMatrix, as done without filter.
+ * @param p the three points of the plane followed by the tested point
+ * @return the 4x4 determinant.
+ */
+template <typename Integer>
+Integer matrixOrientation( const Point* p )
+{
+  SimpleMatrix<Integer, 4, 4> m;
+  for ( int i = 0; i < 4; ++i )
+    {
+      for ( int j = 0; j < 3; ++j )
+        m.setComponent( i, j, static_cast<Integer>( p[ i ][ j ] ) );
+      m.setComponent( i, 3, NumberTraits<Integer>::ONE );
+    }
+  return m.determinant();
+}
+
+/**
+ * @param range coordinates are chosen in [-range,range]
+ * @param n number of groups of points
+ * @param coplanar 'true' to choose the tested points on the plane
+ * of the three first points
+ * @return n groups of five points
+ */
+std::vector<Point> randomPoints( int range, int n, bool coplanar )
+{
+  std::vector<Point> pts( 5 * n );
+  for ( unsigned int i = 0; i < pts.size(); ++i )
+    for ( int j = 0; j < 3; ++j )
+      pts[ i ][ j ] = ( rand() % ( 2 * range + 1 ) ) - range;
+  if ( coplanar )
+    for ( int k = 0; k < n; ++k )
+      {
+        Point* p = &pts[ 5 * k ];
+        p[ 3 ] = p[ 0 ] + ( p[ 1 ] - p[ 0 ] ) * 2 - ( p[ 2 ] - p[ 0 ] );
+      }
+  return pts;
+}
+
+/**
+ * Outputs the running times of the orientation and in-sphere tests
+ * of @a n groups of points.
+ */
+bool benchmark( int range, int n, bool coplanar )
+{
+  srand( 0 );
+  const std::vector<Point> pts = randomPoints( range, n, coplanar );
+  long sum = 0;
+  std::cout << range << " " << ( coplanar ? "coplanar" : "random" );
+
+  clock_t t = clock();
+  for ( int k = 0; k < n; ++k )
+    sum += ( matrixOrientation<DGtal::int64_t>( &pts[ 5 * k ] ) > 0 ) ? 1 : 0;
+  std::cout << " " << double( clock() - t ) / CLOCKS_PER_SEC;
+
+  t = clock();
+  InHalfSpaceByFilteredDet<Point, DGtal::int64_t> orientation;
+  for ( int k = 0; k < n; ++k )
+    {
+      const Point* p = &pts[ 5 * k ];
+      orientation.init( p[ 0 ], p[ 1 ], p[ 2 ] );
+      sum += ( orientation( p[ 3 ] ) > 0 ) ? 1 : 0;
+    }
+  std::cout << " " << double( clock() - t ) / CLOCKS_PER_SEC;
+
+  t = clock();
+  for ( int k = 0; k < n; ++k )
+    sum += ( matrixInSphere<DGtal::int64_t>( &pts[ 5 * k ] ) > 0 ) ? 1 : 0;
+  std::cout << " " << double( clock() - t ) / CLOCKS_PER_SEC;
+
+  // The sphere is initialized once and tested against many points.
+  t = clock();
+  InBallByFilteredDet<Point, DGtal::int64_t> inSphere( range );
+  int nbSpheres = 0;
+  for ( int k = 0; k < n; k += 100 )
+    {
+      const Point* p = &pts[ 5 * k ];
+      orientation.init( p[ 0 ], p[ 1 ], p[ 2 ] );
+      if ( orientation( p[ 4 ] ) == 0 ) continue;
+      inSphere.init( p[ 0 ], p[ 1 ], p[ 2 ], p[ 4 ] );
+      nbSpheres++;
+      for ( int l = 0; l < 100; ++l )
+        sum += ( inSphere( pts[ 5 * l + 3 ] ) > 0 ) ? 1 : 0;
+    }
+  std::cout << " " << double( clock() - t ) / CLOCKS_PER_SEC
+            << " (" << sum << " " << nbSpheres << ")" << std::endl;
+  return true;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc, char** argv )
+{
+  const int n = ( argc > 1 ) ? atoi( argv[ 1 ] ) : 1000000;
+  std::cout << "# Usage: " << argv[0] << " <nbtries>." << std::endl;
+  std::cout << "# running times in s. for " << n << " tries" << std::endl;
+  std::cout << "# columns: range input orientation-matrix-int64 orientation-filtered-int64"
+            << " insphere-matrix-int64 insphere-filtered-int64" << std::endl;
+  bool res = benchmark( 100, n, false ) && benchmark( 100, n, true )
+    && benchmark( 500, n, false ) && benchmark( 500, n, true );
+  return res ? 0 : 1;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
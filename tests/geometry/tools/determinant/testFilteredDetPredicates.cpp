@@ -0,0 +1,253 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testFilteredDetPredicates.cpp
+ * @ingroup Tests
+ *
+ * @author DGtal development team (\c dgtal-devel@lists.gforge.liris.cnrs.fr )
+ *
+ * @date 2026/10/19
+ *
+ * Functions for testing classes InHalfSpaceByFilteredDet and
+ * InBallByFilteredDet.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <cstdlib>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "DGtal/kernel/PointVector.h"
+
+#include "DGtal/geometry/tools/determinant/COrientationFunctor.h"
+#include "DGtal/geometry/tools/determinant/COrientationFunctor2.h"
+#include "DGtal/geometry/tools/determinant/InHalfPlaneBySimple3x3Matrix.h"
+#include "DGtal/geometry/tools/determinant/InHalfSpaceByFilteredDet.h"
+#include "DGtal/geometry/tools/determinant/InBallByFilteredDet.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing the filtered predicates.
+///////////////////////////////////////////////////////////////////////////////
+/**
+ * @param m a square matrix of integers
+ * @return its determinant, computed by a Laplace expansion.
+ */
+DGtal::int64_t laplaceDeterminant( const std::vector< std::vector<DGtal::int64_t> >& m )
+{
+  if ( m.size() == 1 ) return m[ 0 ][ 0 ];
+  DGtal::int64_t det = 0;
+  for ( unsigned int j = 0; j < m.size(); ++j )
+    {
+      std::vector< std::vector<DGtal::int64_t> > minor;
+      for ( unsigned int i = 1; i < m.size(); ++i )
+        {
+          std::vector<DGtal::int64_t> row( m[ i ] );
+          row.erase( row.begin() + j );
+          minor.push_back( row );
+        }
+      const DGtal::int64_t c = m[ 0 ][ j ] * laplaceDeterminant( minor );
+      det += ( j % 2 == 0 ) ? c : -c;
+    }
+  return det;
+}
+
+/**
+ * @param pts a range of points
+ * @param lifted 'true' to add the squared norms
+ * @return the sign of the determinant of the difference vectors
+ * from the first point (lifted or not).
+ */
+template <typename Point>
+int referenceSign( const std::vector<Point>& pts, bool lifted )
+{
+  std::vector< std::vector<DGtal::int64_t> > m;
+  for ( unsigned int i = 1; i < pts.size(); ++i )
+    {
+      std::vector<DGtal::int64_t> row;
+      DGtal::int64_t n = 0;
+      for ( unsigned int j = 0; j < Point::dimension; ++j )
+        {
+          const DGtal::int64_t d = static_cast<DGtal::int64_t>( pts[ i ][ j ] ) - pts[ 0 ][ j ];
+          row.push_back( d );
+          n += d * d;
+        }
+      if ( lifted ) row.push_back( n );
+      m.push_back( row );
+    }
+  const DGtal::int64_t det = laplaceDeterminant( m );
+  return ( det > 0 ) - ( det < 0 );
+}
+
+/**
+ * Compares the filtered orientation and in-ball predicates to the
+ * reference signs on random (and often degenerate) points.
+ * @param f any orientation functor
+ * @param b any in-ball functor
+ * @param range points are chosen in [-range,range]^d
+ * @param nbtries number of tests
+ * @tparam Orientation an instance of InHalfSpaceByFilteredDet
+ * @tparam InBall an instance of InBallByFilteredDet
+ */
+template <typename Orientation, typename InBall>
+bool testRandom( Orientation f, InBall b, int range, unsigned int nbtries )
+{
+  BOOST_CONCEPT_ASSERT(( concepts::COrientationFunctor<Orientation> ));
+  BOOST_CONCEPT_ASSERT(( concepts::COrientationFunctor<InBall> ));
+  typedef typename Orientation::Point Point;
+  typedef typename Orientation::Value Value;
+  const unsigned int dim = Point::dimension;
+
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+  trace.beginBlock ( "Random tests..." );
+  trace.info() << f << " " << b << " range=" << range << endl;
+  for ( unsigned int k = 0; k < nbtries; ++k )
+    {
+      std::vector<Point> pts( dim + 2 );
+      for ( unsigned int i = 0; i < pts.size(); ++i )
+        for ( unsigned int j = 0; j < dim; ++j )
+          pts[ i ][ j ] = ( rand() % ( 2 * range + 1 ) ) - range;
+      // half of the tests on the hyperplane through the first points
+      if ( k % 2 == 0 )
+        pts[ dim ] = pts[ 0 ] + ( pts[ 1 ] - pts[ 0 ] ) * 2 - ( pts[ dim - 1 ] - pts[ 0 ] );
+
+      typename Orientation::PointArray simplex;
+      for ( unsigned int i = 0; i < dim; ++i ) simplex[ i ] = pts[ i ];
+      f.init( simplex );
+      const Value o = f( pts[ dim ] );
+      std::vector<Point> first( pts.begin(), pts.begin() + dim + 1 );
+      nbok += ( o == referenceSign( first, false ) ) ? 1 : 0;
+      nb++;
+
+      if ( referenceSign( first, false ) != 0 )
+        { // in-ball test of the last point (or of a given point of the ball)
+          typename InBall::PointArray ball;
+          for ( unsigned int i = 0; i <= dim; ++i ) ball[ i ] = pts[ i ];
+          b.init( ball );
+          const Point t = ( k % 3 == 0 ) ? pts[ k % ( dim + 1 ) ] : pts[ dim + 1 ];
+          std::vector<Point> all( pts.begin(), pts.begin() + dim + 1 );
+          all.push_back( t );
+          const int expected = referenceSign( all, true ) * referenceSign( first, false );
+          nbok += ( b( t ) == expected ) ? 1 : 0;
+          nb++;
+        }
+    }
+  trace.info() << "(" << nbok << "/" << nb << ") " << endl;
+  trace.endBlock();
+  return nbok == nb;
+}
+
+/**
+ * Tests the in-circle and in-sphere predicates on simple configurations.
+ */
+bool testInBall()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+  trace.beginBlock ( "In-circle and in-sphere..." );
+  typedef PointVector<2, DGtal::int32_t> Point2;
+  typedef PointVector<3, DGtal::int32_t> Point3;
+  InBallByFilteredDet<Point2, DGtal::int64_t> inCircle;
+  inCircle.init( Point2(5,0), Point2(0,5), Point2(-5,0) );
+  nbok += ( inCircle( Point2(-4,1) ) == -1 ) ? 1 : 0;
+  nbok += ( inCircle( Point2(3,-4) ) == 0 ) ? 1 : 0;
+  nbok += ( inCircle( Point2(4,4) ) == 1 ) ? 1 : 0;
+  nb += 3;
+  inCircle.init( Point2(-5,0), Point2(0,5), Point2(5,0) ); //clockwise
+  nbok += ( inCircle( Point2(-4,1) ) == -1 ) ? 1 : 0;
+  nbok += ( inCircle( Point2(4,4) ) == 1 ) ? 1 : 0;
+  nb += 2;
+  InBallByFilteredDet<Point3, DGtal::int64_t> inSphere( 10 );
+  inSphere.init( Point3(5,0,0), Point3(0,5,0), Point3(0,0,5), Point3(-5,0,0) );
+  nbok += ( inSphere( Point3(0,0,0) ) == -1 ) ? 1 : 0;
+  nbok += ( inSphere( Point3(3,0,-4) ) == 0 ) ? 1 : 0;
+  nbok += ( inSphere( Point3(0,-3,4) ) == 0 ) ? 1 : 0;
+  nbok += ( inSphere( Point3(3,3,3) ) == 1 ) ? 1 : 0;
+  nbok += ( inSphere( Point3(30,0,0) ) == 1 ) ? 1 : 0; //beyond the static bound
+  nb += 5;
+  trace.info() << "(" << nbok << "/" << nb << ") " << endl;
+  trace.endBlock();
+  return nbok == nb;
+}
+
+/**
+ * Tests the orientation predicate on nearly degenerate configurations
+ * with large coordinates, where the floating-point determinant is inexact.
+ */
+bool testLargeCoordinates()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+  trace.beginBlock ( "Large coordinates..." );
+  typedef PointVector<2, DGtal::int32_t> Point;
+  typedef InHalfPlaneBySimple3x3Matrix<Point, DGtal::int64_t> Reference;
+  InHalfSpaceByFilteredDet<Point, DGtal::int64_t> f;
+  Reference g;
+  const DGtal::int32_t m = 1 << 29;
+  for ( int dx = -2; dx <= 2; ++dx )
+    for ( int dy = -2; dy <= 2; ++dy )
+      {
+        const Point p( -m, -m + 1 ), q( m - 1, m );
+        const Point r( m / 3 + dx, m / 3 + 1 + dy );
+        f.init( p, q );
+        g.init( p, q );
+        const DGtal::int64_t expected = g( r );
+        nbok += ( f( r ) == ( ( expected > 0 ) - ( expected < 0 ) ) ) ? 1 : 0;
+        nb++;
+      }
+  trace.info() << "(" << nbok << "/" << nb << ") " << endl;
+  trace.endBlock();
+  return nbok == nb;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc, char** argv )
+{
+  trace.beginBlock ( "Testing filtered determinant predicates" );
+  trace.info() << "Args:";
+  for ( int i = 0; i < argc; ++i )
+    trace.info() << " " << argv[ i ];
+  trace.info() << endl;
+
+  typedef PointVector<2, DGtal::int32_t> Point2;
+  typedef PointVector<3, DGtal::int32_t> Point3;
+  typedef InHalfSpaceByFilteredDet<Point2, DGtal::int64_t> Orientation2;
+  typedef InHalfSpaceByFilteredDet<Point3, DGtal::int64_t> Orientation3;
+  typedef InBallByFilteredDet<Point2, DGtal::int64_t> InCircle;
+  typedef InBallByFilteredDet<Point3, DGtal::int64_t> InSphere;
+
+  bool res = testInBall()
+    && testLargeCoordinates()
+    && testRandom( Orientation2(), InCircle(), 1000, 10000 )
+    && testRandom( Orientation2( 1000 ), InCircle( 1000 ), 1000, 10000 )
+    && testRandom( Orientation3(), InSphere(), 100, 10000 )
+    && testRandom( Orientation3( 100 ), InSphere( 100 ), 100, 10000 )
+    && testRandom( Orientation3( 100 ), InSphere( 100 ), 3, 10000 );
+  trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
+  trace.endBlock();
+  return res ? 0 : 1;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
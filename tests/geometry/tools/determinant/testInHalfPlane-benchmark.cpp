@@ -43,6 +43,7 @@
 #include "DGtal/geometry/tools/determinant/COrientationFunctor2.h"
 #include "DGtal/geometry/tools/determinant/InHalfPlaneBy2x2DetComputer.h"
 #include "DGtal/geometry/tools/determinant/InHalfPlaneBySimple3x3Matrix.h"
+#include "DGtal/geometry/tools/determinant/InHalfSpaceByFilteredDet.h"
 ///////////////////////////////////////////////////////////////////////////////
 
 using namespace std;
@@ -685,6 +686,42 @@ bool randomTest30All()
     quasiNullTest( F(), signedRandomInt15 ); 
     std::cout << std::endl;   
   }
+  {
+    srand(seed); 
+    std::cout << "filtered-int32-int64 "; 
+    typedef InHalfSpaceByFilteredDet<Point, DGtal::int64_t> F; 
+    randomTest( F(), signedRandomInt30 );
+    nullSameVectorsTest( F(), signedRandomInt30 );
+    nullZeroVectorTest( F(), signedRandomInt30 ); 
+    nullTest( F(), signedRandomInt15 ); 
+    quasiNullTest( F(), signedRandomInt15 ); 
+    std::cout << std::endl;   
+  }
+  {
+    srand(seed); 
+    std::cout << "static-filtered-int32-int64 "; 
+    typedef InHalfSpaceByFilteredDet<Point, DGtal::int64_t> F; 
+    const double bound = 1073741824.0; 
+    randomTest( F( bound ), signedRandomInt30 );
+    nullSameVectorsTest( F( bound ), signedRandomInt30 );
+    nullZeroVectorTest( F( bound ), signedRandomInt30 ); 
+    nullTest( F( bound ), signedRandomInt15 ); 
+    quasiNullTest( F( bound ), signedRandomInt15 ); 
+    std::cout << std::endl;   
+  }
+#ifdef WITH_BIGINTEGER
+  {
+    srand(seed); 
+    std::cout << "filtered-int32-BigInt "; 
+    typedef InHalfSpaceByFilteredDet<Point, DGtal::BigInteger> F; 
+    randomTest( F(), signedRandomInt30 );
+    nullSameVectorsTest( F(), signedRandomInt30 );
+    nullZeroVectorTest( F(), signedRandomInt30 ); 
+    nullTest( F(), signedRandomInt15 ); 
+    quasiNullTest( F(), signedRandomInt15 ); 
+    std::cout << std::endl;   
+  }
+#endif
 
   return true; 
 }
@@ -38,6 +38,7 @@
 #include "DGtal/geometry/tools/determinant/COrientationFunctor2.h"
 #include "DGtal/geometry/tools/determinant/InHalfPlaneBy2x2DetComputer.h"
 #include "DGtal/geometry/tools/determinant/InHalfPlaneBySimple3x3Matrix.h"
+#include "DGtal/geometry/tools/determinant/InHalfSpaceByFilteredDet.h"
 
 #include "DGtal/geometry/tools/determinant/InGeneralizedDiskOfGivenRadius.h"
 ///////////////////////////////////////////////////////////////////////////////
@@ -285,6 +286,10 @@ int main( int argc, char** argv )
   typedef InHalfPlaneBySimple3x3Matrix<Point, DGtal::int32_t> Functor2; 
   res = res && testInHalfPlane( Functor2() );
 
+  typedef InHalfSpaceByFilteredDet<Point, DGtal::int64_t> Functor3; 
+  res = res && testInHalfPlane( Functor3() );
+  res = res && testInHalfPlane( Functor3( 100 ) );
+
   res = res && testInGeneralizedDiskOfGivenRadius(); 
 
   trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
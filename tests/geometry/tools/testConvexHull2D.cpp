@@ -29,6 +29,8 @@
 
 ///////////////////////////////////////////////////////////////////////////////
 #include <iostream>
+#include <limits>
+#include <vector>
 #include "DGtal/base/Common.h"
 #include "DGtal/base/Circulator.h"
 
@@ -330,6 +332,105 @@ bool testConvexHullCompThickness()
   return nb==nbok;
 }
 
+/**
+ * Testing the exact orientation test, the Akl-Toussaint filter,
+ * the parallel and batch convex hull computations.
+ * @return 'true' if passed.
+ */
+bool testParallelConvexHull2D()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+  using namespace functions::Hull2D;
+
+  trace.beginBlock ( "Exact orientation..." );
+  typedef PointVector<2,DGtal::int32_t> Point;
+  typedef PointVector<2,DGtal::int64_t> BigPoint;
+  const DGtal::int32_t m = std::numeric_limits<DGtal::int32_t>::max();
+  nbok += ( orientation( Point(0,0), Point(1,0), Point(0,1) ) == 1 ) ? 1 : 0;
+  nbok += ( orientation( Point(0,0), Point(0,1), Point(1,0) ) == -1 ) ? 1 : 0;
+  nbok += ( orientation( Point(-m,-m), Point(m,m), Point(0,0) ) == 0 ) ? 1 : 0;
+  nbok += ( orientation( Point(-m,-m), Point(m,m), Point(0,1) ) == 1 ) ? 1 : 0;
+  nbok += ( orientation( Point(-m,-m), Point(m,m-1), Point(0,0) ) == 1 ) ? 1 : 0;
+  nb += 5;
+  // Nearly collinear vectors with large 64-bit coordinates (the
+  // floating-point determinant is zero).
+  const DGtal::int64_t big = DGtal::int64_t( 1 ) << 60;
+  nbok += ( orientation( BigPoint(0,0), BigPoint(big,big+1), BigPoint(big-1,big) ) == 1 ) ? 1 : 0;
+  nbok += ( orientation( BigPoint(0,0), BigPoint(big-1,big), BigPoint(big,big+1) ) == -1 ) ? 1 : 0;
+  nbok += ( orientation( BigPoint(0,0), BigPoint(big,big), BigPoint(big/2,big/2) ) == 0 ) ? 1 : 0;
+  nb += 3;
+  std::vector<Point> line;
+  for (int j = -3; j <= 3; j++)
+    line.push_back( Point(j, 1 - j) );
+  std::vector<int> signs;
+  orientations( Point(0,0), Point(1,-1), line.begin(), line.end(), back_inserter( signs ) );
+  bool ok = ( signs.size() == line.size() );
+  for (unsigned int j = 0; ok && (j < line.size()); j++)
+    ok = ( signs[ j ] == orientation( Point(0,0), Point(1,-1), line[ j ] ) ) && ( signs[ j ] == 1 );
+  nbok += ok ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") " << endl;
+  trace.endBlock();
+
+  trace.beginBlock ( "Akl-Toussaint filter..." );
+  std::vector<Point> square;
+  for (int x = 0; x <= 10; x++)
+    for (int y = 0; y <= 10; y++)
+      square.push_back( Point(x, y) );
+  aklToussaintFilter( square );
+  // The extreme points are (0,0), (0,0), (10,0), (0,10): the points
+  // strictly inside the triangle x > 0, y > 0, x + y < 10 are removed.
+  nbok += ( square.size() == 121 - 36 ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") " << endl;
+  trace.endBlock();
+
+  trace.beginBlock ( "Parallel convex hull..." );
+  typedef InHalfPlaneBySimple3x3Matrix<Point, DGtal::int64_t> Functor;
+  Functor functor;
+  PredicateFromOrientationFunctor2<Functor> predicate( functor );
+  OrientationPredicate<> parallelPredicate;
+  std::vector<Point> randomData, res1, res2;
+  for (int i = 0; ( (i < 5)&&(nbok == nb) ); i++)
+    {
+      randomData.clear();
+      res1.clear();
+      res2.clear();
+      for (int j = 0; j < 50000; j++)
+        randomData.push_back( Point(rand()%4096 - 2048, rand()%4096 - 2048) );
+      andrewConvexHullAlgorithm( randomData.begin(), randomData.end(), back_inserter( res1 ), predicate );
+      parallelAndrewConvexHullAlgorithm( randomData.begin(), randomData.end(), back_inserter( res2 ), parallelPredicate );
+      nbok += ( res1 == res2 ) ? 1 : 0;
+      nb++;
+      trace.info() << "(" << nbok << "/" << nb << ") " << res1.size() << " vertices" << endl;
+    }
+  trace.endBlock();
+
+  trace.beginBlock ( "Batch convex hulls and thickness..." );
+  std::vector< std::vector<Point> > sets( 500 ), hulls;
+  for (unsigned int i = 0; i < sets.size(); i++)
+    for (unsigned int j = 0; j < i % 50; j++)
+      sets[ i ].push_back( Point(rand()%64, rand()%64) );
+  batchAndrewConvexHullAlgorithm( sets.begin(), sets.end(), hulls, parallelPredicate );
+  std::vector<double> thicknesses;
+  batchComputeHullThickness( hulls.begin(), hulls.end(), EuclideanThickness, thicknesses );
+  ok = ( hulls.size() == sets.size() ) && ( thicknesses.size() == sets.size() );
+  for (unsigned int i = 0; ok && (i < sets.size()); i++)
+    {
+      res1.clear();
+      andrewConvexHullAlgorithm( sets[ i ].begin(), sets[ i ].end(), back_inserter( res1 ), predicate );
+      ok = ( res1 == hulls[ i ] )
+        && ( thicknesses[ i ] == computeHullThickness( res1.begin(), res1.end(), EuclideanThickness ) );
+    }
+  nbok += ok ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") " << endl;
+  trace.endBlock();
+
+  return nbok == nb;
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // Standard services - public :
 
@@ -341,7 +442,8 @@ int main( int argc, char** argv )
     trace.info() << " " << argv[ i ];
   trace.info() << endl;
 
-  bool res = testConvexHull2D() &&testConvexHullCompThickness();
+  bool res = testConvexHull2D() &&testConvexHullCompThickness()
+    && testParallelConvexHull2D();
   trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
   trace.endBlock();
   return res ? 0 : 1;
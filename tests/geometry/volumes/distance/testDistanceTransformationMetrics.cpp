@@ -34,6 +34,9 @@
 #include "DGtal/geometry/volumes/distance/DistanceTransformation.h"
 #include "DGtal/geometry/volumes/distance/ExactPredicateLpSeparableMetric.h"
 #include "DGtal/geometry/volumes/distance/InexactPredicateLpSeparableMetric.h"
+#include "DGtal/geometry/volumes/distance/ExactPredicateAnisotropicL2SeparableMetric.h"
+#include "DGtal/geometry/volumes/distance/ChamferNorm3D.h"
+#include "DGtal/geometry/volumes/distance/CSeparableMetric.h"
 #include "DGtal/images/ImageContainerBySTLVector.h"
 #include "DGtal/kernel/sets/DigitalSetBySTLSet.h"
 ///////////////////////////////////////////////////////////////////////////////
@@ -172,6 +175,106 @@ bool testCompareInexactBruteForce(double norm, unsigned int size, unsigned int n
   return res;
 }
 
+
+template <typename Space, typename Metric>
+bool testCompareMetricBruteForce(const Metric &metric, unsigned int size, unsigned int nb)
+{
+  trace.beginBlock("Checking separable metric against brute force");
+  typedef HyperRectDomain<Space> Domain;
+  typedef typename Space::Point Point;
+  typedef DigitalSetBySTLSet<Domain> Set;
+  typedef functors::NotPointPredicate<Set> NegPredicate;
+  
+  Point low=Point::diagonal(0),
+  up=Point::diagonal(size);
+  
+  Domain domain(low,up);
+  Set set(domain);
+  
+  for(unsigned int i = 0; i<nb; ++i)
+  {
+    Point p;
+    for(unsigned int dim=0;  dim<Space::dimension;++dim)
+      p[dim]  = rand() % size;
+    set.insert(p);
+  }
+  
+  trace.info()<< "Testing metrics "<<metric<<std::endl;
+  trace.info()<< "Testing space dimension "<<Space::dimension<<std::endl;
+  trace.info()<< "Inserting "<<set.size() << " points."<<std::endl;
+  
+  NegPredicate negPred(set);
+  
+  typedef DistanceTransformation<Space, NegPredicate, Metric> DT;
+  DT dt(&domain, &negPred, &metric);
+  
+  bool res=checkVoronoi(dt, negPred, metric);
+  
+  trace.endBlock();
+  return res;
+}
+
+bool testAnisotropicAndChamfer3D()
+{
+  BOOST_CONCEPT_ASSERT(( concepts::CSeparableMetric< ExactPredicateAnisotropicL2SeparableMetric<Z3i::Space> > ));
+  BOOST_CONCEPT_ASSERT(( concepts::CSeparableMetric< experimental::ChamferNorm3D<Z3i::Space> > ));
+
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+  trace.beginBlock("Anisotropic l_2 and 3D chamfer norm values");
+
+  //Isotropic weights give back the l_2 metric
+  ExactPredicateAnisotropicL2SeparableMetric<Z3i::Space> iso;
+  ExactPredicateLpSeparableMetric<Z3i::Space, 2> l2;
+  const Z3i::Point a(1,-2,3), b(4,5,-1);
+  nbok += ( iso.rawDistance(a,b) == l2.rawDistance(a,b) ) ? 1 : 0;
+  nb++;
+
+  //0.7 x 0.7 x 2.5 mm voxels
+  ExactPredicateAnisotropicL2SeparableMetric<Z3i::Space> ct(Z3i::Vector(7,7,25), 10.0);
+  nbok += ( ct.rawDistance(a,b) == 49*9 + 49*49 + 625*16 ) ? 1 : 0;
+  nb++;
+  nbok += ( std::abs( ct(Z3i::Point(0,0,0), Z3i::Point(0,0,2)) - 5.0 ) < 1e-12 ) ? 1 : 0;
+  nb++;
+
+  //3-4 masks (3-4-5 weights on the 3x3x3 neighborhood)
+  typedef experimental::ChamferNorm3D<Z3i::Space> Chamfer;
+  Chamfer mask34;
+  const Z3i::Point o(0,0,0);
+  nbok += ( mask34(o, Z3i::Point(1,0,0)) == 1.0 && mask34(o, Z3i::Point(0,0,-1)) == 1.0 ) ? 1 : 0;
+  nb++;
+  nbok += ( mask34.rawDistance(o, Z3i::Point(0,-1,1)) * 3 == 4 * 9 ) ? 1 : 0;
+  nb++;
+  nbok += ( mask34.rawDistance(o, Z3i::Point(-1,1,-1)) * 3 == 5 * 9 ) ? 1 : 0;
+  nb++;
+  nbok += ( mask34.rawDistance(o, Z3i::Point(1,-2,0)) * 3 == 7 * 9 ) ? 1 : 0;
+  nb++;
+  //Same norm from its facet normals
+  Chamfer::Normals normals;
+  normals.push_back(Chamfer::Normal(1,-3));
+  Chamfer mask34bis(normals, normals);
+  nbok += ( mask34bis(o, Z3i::Point(4,-2,7)) == mask34(o, Z3i::Point(4,-2,7)) ) ? 1 : 0;
+  nb++;
+  //5-7-11 planar mask
+  Chamfer::Normals normals5711;
+  normals5711.push_back(Chamfer::Normal(5,1));
+  normals5711.push_back(Chamfer::Normal(4,3));
+  Chamfer mask5711(normals5711, normals);
+
+  trace.info() << "(" << nbok << "/" << nb << ") " << std::endl;
+  trace.endBlock();
+
+  return ( nbok == nb )
+    && testCompareMetricBruteForce<Z3i::Space>(ct, 10, 6)
+    && testCompareMetricBruteForce<Z3i::Space>(
+         ExactPredicateAnisotropicL2SeparableMetric<Z3i::Space>(Z3i::Vector(1,3,2)), 12, 8)
+    && testCompareMetricBruteForce<Z2i::Space>(
+         ExactPredicateAnisotropicL2SeparableMetric<Z2i::Space>(Z2i::Vector(5,2)), 16, 8)
+    && testCompareMetricBruteForce<Z3i::Space>(mask34, 12, 8)
+    && testCompareMetricBruteForce<Z3i::Space>(Chamfer(5,7), 10, 5)
+    && testCompareMetricBruteForce<Z3i::Space>(mask5711, 12, 10);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // Standard services - public :
 
@@ -191,7 +294,8 @@ int main( int argc, char** argv )
   && testCompareInexactBruteForce<Z2i::Space>(1.33,16, 8)
   && testCompareInexactBruteForce<Z2i::Space>(2.6,16, 8) 
   && testCompareInexactBruteForce<Z3i::Space>(2.44,10, 5)
-  && testCompareInexactBruteForce<Z3i::Space>(12.3,10, 5); 
+  && testCompareInexactBruteForce<Z3i::Space>(12.3,10, 5)
+  && testAnisotropicAndChamfer3D();
   trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
   trace.endBlock();
   return res ? 0 : 1;
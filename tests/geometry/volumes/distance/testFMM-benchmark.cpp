@@ -0,0 +1,136 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testFMM-benchmark.cpp
+ * @ingroup Tests
+ *
+ * @author DGtal development team (\c dgtal-devel@lists.gforge.liris.cnrs.fr )
+ *
+ * @date 2026/10/19
+ *
+ * Benchmark of the fast sweeping method against FMM on 3D signed
+ * distance computations (run with OpenMP to measure the parallel
+ * sweeps).
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <string>
+#include <limits>
+#include <set>
+#include "DGtal/base/Common.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/kernel/domains/DomainPredicate.h"
+#include "DGtal/kernel/sets/DigitalSetFromMap.h"
+#include "DGtal/images/ImageContainerBySTLMap.h"
+#include "DGtal/shapes/Shapes.h"
+#include "DGtal/topology/helpers/Surfaces.h"
+#include "DGtal/geometry/volumes/distance/FMM.h"
+#include "DGtal/geometry/volumes/distance/FastSweepingMethod.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for benchmarking the fast sweeping method.
+///////////////////////////////////////////////////////////////////////////////
+
+/**
+ * Computes the signed distance to the boundary of two balls in a
+ * cube of side @a n, in the whole domain and in a band of width 5, by
+ * FMM and by the fast sweeping method.
+ */
+bool runABenchmark( int n )
+{
+  typedef Z3i::Domain Domain;
+  typedef Z3i::Point Point;
+  typedef ImageContainerBySTLMap<Domain, double> Image;
+  typedef DigitalSetFromMap<Image> Set;
+  typedef functors::DomainPredicate<Domain> Predicate;
+  typedef FMM<Image, Set, Predicate> FMM;
+  typedef FastSweepingMethod<Image, Set, Predicate> FSM;
+
+  trace.beginBlock( "Benchmark on a " + std::to_string( n ) + "^3 domain" );
+  Domain domain( Point::diagonal( 0 ), Point::diagonal( n - 1 ) );
+  Predicate predicate( domain );
+  Z3i::KSpace K;
+  K.init( domain.lowerBound(), domain.upperBound(), true );
+  Z3i::DigitalSet shape( domain );
+  Shapes<Domain>::addNorm2Ball( shape, Point::diagonal( n / 3 ), n / 5 );
+  Shapes<Domain>::addNorm2Ball( shape, Point( 2 * n / 3, n / 2, n / 2 ), n / 4 );
+  std::set<Z3i::SCell> bels;
+  Surfaces<Z3i::KSpace>::sMakeBoundary( bels, K, shape,
+                                        domain.lowerBound(), domain.upperBound() );
+  trace.info() << bels.size() << " bels." << std::endl;
+
+  bool ok = true;
+  const double thresholds[ 2 ] = { std::numeric_limits<double>::max(), 5.0 };
+  for ( double threshold : thresholds )
+    {
+      const std::string band = ( threshold < std::numeric_limits<double>::max() )
+        ? " (abs < " + std::to_string( threshold ) + ")" : "";
+      Image fmmImage( domain, 0.0 ), fsmImage( domain, 0.0 );
+      Set fmmSet( fmmImage ), fsmSet( fsmImage );
+      FMM::initFromBelsRange( K, bels.begin(), bels.end(), fmmImage, fmmSet, 0.5 );
+      FMM::initFromBelsRange( K, bels.begin(), bels.end(), fsmImage, fsmSet, 0.5 );
+
+      trace.beginBlock( "FMM" + band );
+      FMM fmm( fmmImage, fmmSet, predicate, domain.size() + 1, threshold );
+      fmm.compute();
+      trace.info() << fmm << std::endl;
+      trace.endBlock();
+
+      trace.beginBlock( "Fast sweeping method" + band );
+      FSM fsm( fsmImage, fsmSet, predicate, threshold );
+      fsm.compute();
+      trace.info() << fsm << std::endl;
+      trace.endBlock();
+
+      double maxError = 0.0;
+      ok = ok && ( fmmSet.size() == fsmSet.size() );
+      for ( auto const & p : fmmSet )
+        maxError = std::max( maxError, std::abs( fmmImage( p ) - fsmImage( p ) ) );
+      trace.info() << "max difference: " << maxError << std::endl;
+      ok = ok && ( maxError < 1e-6 );
+    }
+
+  trace.endBlock();
+  return ok;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc, char** argv )
+{
+  trace.beginBlock ( "Benchmarking class FastSweepingMethod" );
+  trace.info() << "Args:";
+  for ( int i = 0; i < argc; ++i )
+    trace.info() << " " << argv[ i ];
+  trace.info() << endl;
+
+  const int n = argc > 1 ? std::atoi( argv[ 1 ] ) : 64;
+  bool res = runABenchmark( n / 2 ) && runABenchmark( n );
+  trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
+  trace.endBlock();
+  return res ? 0 : 1;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
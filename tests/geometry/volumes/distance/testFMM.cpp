@@ -48,6 +48,12 @@
 
 //FMM
 #include "DGtal/geometry/volumes/distance/FMM.h"
+#include "DGtal/geometry/volumes/distance/FastSweepingMethod.h"
+#include "DGtal/geometry/volumes/distance/NarrowBandFIM.h"
+#include "DGtal/geometry/volumes/distance/SurfaceFMM.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/topology/DigitalSetBoundary.h"
+#include "DGtal/topology/IndexedDigitalSurface.h"
 
 //Display
 #include "DGtal/io/colormaps/HueShadeColorMap.h"
@@ -653,6 +659,257 @@ bool testComparison(int size, int area, double dist)
 
 
 
+/**
+ * Comparison of the narrow band FIM with FMM, from the bels of a ball
+ * (signed distance) and from isolated points.
+ *
+ */
+bool testNarrowBandFIM(int size, double band)
+{
+  typedef Z3i::Domain Domain;
+  typedef Z3i::Point Point;
+  Domain d(Point::diagonal(-size), Point::diagonal(size));
+  DomainPredicate<Domain> dp(d);
+
+  Z3i::KSpace K;
+  K.init( d.lowerBound(), d.upperBound(), true );
+  Z3i::DigitalSet ball( d );
+  Shapes<Domain>::addNorm2Ball( ball, Point( 1, -2, 0 ), size / 2 );
+  std::set<Z3i::SCell> bels;
+  Surfaces<Z3i::KSpace>::sMakeBoundary( bels, K, ball,
+                                        d.lowerBound(), d.upperBound() );
+  std::vector<Point> points;
+  points.push_back( Point( -size / 2, size / 3, 1 ) );
+  points.push_back( Point( size / 2, -size / 2, -size / 3 ) );
+
+  bool flagIsOk = true;
+  for ( int mode = 0; mode < 2; ++mode )
+    {
+      trace.beginBlock ( mode == 0 ? " Narrow band from bels " : " Narrow band from points " );
+      typedef ImageContainerBySTLMap<Domain,double> Image;
+      Image map( d, 0.0 );
+      typedef DigitalSetFromMap<Image> Set;
+      Set set(map);
+      typedef FMM<Image, Set, DomainPredicate<Domain> > FMM;
+      NarrowBandFIM<Z3i::Space> fim( d, band, 4 );
+      if ( mode == 0 )
+        {
+          FMM::initFromBelsRange( K, bels.begin(), bels.end(), map, set, 0.5 );
+          fim.initFromBelsRange( K, bels.begin(), bels.end() );
+        }
+      else
+        {
+          FMM::initFromPointsRange( points.begin(), points.end(), map, set, 0.0 );
+          fim.initFromPointsRange( points.begin(), points.end() );
+        }
+      FMM fmm( map, set, dp, d.size() + 1, band );
+      fmm.compute();
+      trace.info() << fmm << std::endl;
+      const std::size_t nb = fim.compute();
+      trace.info() << fim << ", " << nb << " points in the band" << std::endl;
+
+      //same points and same values in the band
+      double maxError = 0.0;
+      bool ok = ( nb == set.size() );
+      for ( auto const & p : d )
+        if ( set.find( p ) != set.end() )
+          maxError = std::max( maxError, std::abs( fim( p ) - map( p ) ) );
+        else
+          ok = ok && ( fim( p ) == std::numeric_limits<double>::infinity() );
+      trace.info() << "max error: " << maxError << std::endl;
+      flagIsOk = flagIsOk && ok && ( maxError < 1e-9 );
+      trace.endBlock();
+    }
+  return flagIsOk;
+}
+
+/**
+ * Comparison of the fast sweeping method with FMM: L2 signed
+ * distance from the bels of a ball within a band, L2 distance from
+ * isolated points, and L1 distance around a wall (2d).
+ *
+ */
+bool testFastSweepingMethod(int size)
+{
+  bool flagIsOk = true;
+  {
+    typedef Z3i::Domain Domain;
+    typedef Z3i::Point Point;
+    Domain d(Point::diagonal(-size), Point::diagonal(size));
+    DomainPredicate<Domain> dp(d);
+
+    Z3i::KSpace K;
+    K.init( d.lowerBound(), d.upperBound(), true );
+    Z3i::DigitalSet ball( d );
+    Shapes<Domain>::addNorm2Ball( ball, Point( 1, -2, 0 ), size / 2 );
+    std::set<Z3i::SCell> bels;
+    Surfaces<Z3i::KSpace>::sMakeBoundary( bels, K, ball,
+                                          d.lowerBound(), d.upperBound() );
+    std::vector<Point> points;
+    points.push_back( Point( -size / 2, size / 3, 1 ) );
+    points.push_back( Point( size / 2, -size / 2, -size / 3 ) );
+
+    for ( int mode = 0; mode < 2; ++mode )
+      {
+        trace.beginBlock ( mode == 0 ? " Fast sweeping from bels " : " Fast sweeping from points " );
+        typedef ImageContainerBySTLMap<Domain,double> Image;
+        typedef DigitalSetFromMap<Image> Set;
+        typedef FMM<Image, Set, DomainPredicate<Domain> > FMM;
+        typedef FastSweepingMethod<Image, Set, DomainPredicate<Domain> > FSM;
+        Image map( d, 0.0 ), map2( d, 0.0 );
+        Set set( map ), set2( map2 );
+        const double threshold = ( mode == 0 ) ? 5.5 : std::numeric_limits<double>::max();
+        if ( mode == 0 )
+          {
+            FMM::initFromBelsRange( K, bels.begin(), bels.end(), map, set, 0.5 );
+            FMM::initFromBelsRange( K, bels.begin(), bels.end(), map2, set2, 0.5 );
+          }
+        else
+          {
+            FMM::initFromPointsRange( points.begin(), points.end(), map, set, 0.0 );
+            FMM::initFromPointsRange( points.begin(), points.end(), map2, set2, 0.0 );
+          }
+        FMM fmm( map, set, dp, d.size() + 1, threshold );
+        fmm.compute();
+        trace.info() << fmm << std::endl;
+        FSM fsm( map2, set2, dp, threshold );
+        fsm.compute();
+        trace.info() << fsm << std::endl;
+
+        //same points and same values
+        double maxError = 0.0;
+        bool ok = ( set.size() == set2.size() ) && fsm.isValid();
+        for ( auto const & p : set )
+          if ( set2.find( p ) != set2.end() )
+            maxError = std::max( maxError, std::abs( map( p ) - map2( p ) ) );
+          else
+            ok = false;
+        trace.info() << "max error: " << maxError << std::endl;
+        flagIsOk = flagIsOk && ok && ( maxError < 1e-9 );
+        trace.endBlock();
+      }
+  }
+
+  {
+    trace.beginBlock ( " Fast sweeping around a wall (L1) " );
+    typedef HyperRectDomain< SpaceND<2, int> > Domain;
+    typedef Domain::Point Point;
+    Domain d(Point::diagonal(-size), Point::diagonal(size));
+
+    //the wall is outside the domain of computation
+    typedef ImageContainerBySTLVector<Domain,int> Mask;
+    Mask mask( d );
+    for ( auto const & p : d )
+      mask.setValue( p, ( ( p[ 0 ] == 0 ) && ( p[ 1 ] > -size / 2 ) ) ? 0 : 1 );
+    typedef SimpleThresholdForegroundPredicate<Mask> MaskPredicate;
+    MaskPredicate mp( mask, 0 );
+    DomainPredicate<Domain> dp( d );
+    typedef BinaryPointPredicate<DomainPredicate<Domain>, MaskPredicate, AndBoolFct2> Predicate;
+    AndBoolFct2 andFunctor;
+    Predicate predicate( dp, mp, andFunctor );
+
+    typedef ImageContainerBySTLMap<Domain,double> Image;
+    typedef DigitalSetFromMap<Image> Set;
+    typedef L1LocalDistance<Image, Set> Distance;
+    Image map( d, 0.0 ), map2( d, 0.0 );
+    Set set( map ), set2( map2 );
+    map.setValue( Point( -1, size - 1 ), 0.0 );
+    map2.setValue( Point( -1, size - 1 ), 0.0 );
+    Distance distance( map, set ), distance2( map2, set2 );
+    FMM<Image, Set, Predicate, Distance> fmm( map, set, predicate,
+                                              d.size() + 1, std::numeric_limits<double>::max(),
+                                              distance );
+    fmm.compute();
+    trace.info() << fmm << std::endl;
+    FastSweepingMethod<Image, Set, Predicate, Distance> fsm( map2, set2, predicate, distance2 );
+    fsm.compute();
+    trace.info() << fsm << std::endl;
+
+    bool ok = ( set.size() == set2.size() ) && fsm.isValid();
+    for ( auto const & p : set )
+      ok = ok && ( set2.find( p ) != set2.end() ) && ( map( p ) == map2( p ) );
+    flagIsOk = flagIsOk && ok;
+    trace.endBlock();
+  }
+  return flagIsOk;
+}
+
+/**
+ * Geodesic distances on the boundary of a ball, checked against the
+ * Euclidean distance, the shortest paths along the edges and the
+ * great circle distance.
+ *
+ */
+bool testSurfaceFMM(int radius)
+{
+  using namespace Z3i;
+  typedef DigitalSetBoundary< KSpace, DigitalSet > SurfaceContainer;
+  typedef IndexedDigitalSurface< SurfaceContainer > Surface;
+  typedef Surface::Vertex Vertex;
+
+  Point p1 = Point::diagonal( -radius - 2 );
+  Point p2 = Point::diagonal(  radius + 2 );
+  KSpace K;
+  K.init( p1, p2, true );
+  DigitalSet aSet( Domain( p1, p2 ) );
+  Shapes<Domain>::addNorm2Ball( aSet, Point( 0, 0, 0 ), radius );
+  Surface surface;
+  surface.build( new SurfaceContainer( K, aSet ) );
+
+  trace.beginBlock ( " Surface FMM " );
+  SurfaceFMM<Surface> fmm( surface );
+  const Vertex source = 0;
+  fmm.setSource( source );
+  fmm.compute();
+  trace.info() << fmm << std::endl;
+
+  //shortest paths along the edges
+  const std::size_t n = surface.nbVertices();
+  std::vector<double> dijkstra( n, std::numeric_limits<double>::infinity() );
+  typedef std::pair<double, Vertex> Pair;
+  std::priority_queue< Pair, std::vector<Pair>, std::greater<Pair> > queue;
+  dijkstra[ source ] = 0.0;
+  queue.push( Pair( 0.0, source ) );
+  while ( ! queue.empty() )
+    {
+      const Pair top = queue.top();
+      queue.pop();
+      if ( top.first > dijkstra[ top.second ] ) continue;
+      for ( auto const & a : surface.outArcs( top.second ) )
+        {
+          const Vertex w = surface.head( a );
+          const double dw = top.first
+            + ( surface.position( w ) - surface.position( top.second ) ).norm();
+          if ( dw < dijkstra[ w ] )
+            {
+              dijkstra[ w ] = dw;
+              queue.push( Pair( dw, w ) );
+            }
+        }
+    }
+
+  bool flagIsOk = ( fmm.nbAccepted() == n );
+  double meanError = 0.0;
+  const RealPoint s = surface.position( source );
+  for ( Vertex v = 0; v < n; ++v )
+    {
+      const RealPoint x = surface.position( v );
+      flagIsOk = flagIsOk
+        && ( fmm( v ) >= ( x - s ).norm() - 1e-9 )
+        && ( fmm( v ) <= dijkstra[ v ] + 1e-9 );
+      //great circle distance on the sphere through the surfel centers
+      const double r = 0.5 * ( x.norm() + s.norm() );
+      const double cosAngle = std::max( -1.0, std::min( 1.0, x.dot( s ) / ( x.norm() * s.norm() ) ) );
+      meanError += std::abs( fmm( v ) - r * std::acos( cosAngle ) ) / ( r * M_PI );
+    }
+  meanError /= n;
+  trace.info() << n << " vertices, mean relative error to the great circle distance: "
+               << meanError << std::endl;
+  trace.endBlock();
+  return flagIsOk && ( meanError < 0.05 );
+}
+
+
 ///////////////////////////////////////////////////////////////////////////////
 // Standard services - public :
 
@@ -693,6 +950,13 @@ int main ( int argc, char** argv )
     && testComparison<4,1>( size, area, 4*size+1 )
     ;
 
+  //narrow band, fast sweeping and surface FMM
+  res = res
+    && testNarrowBandFIM( 15, 4.5 )
+    && testFastSweepingMethod( 15 )
+    && testSurfaceFMM( 12 )
+    ;
+
   //&& ... other tests
   trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
   trace.endBlock();
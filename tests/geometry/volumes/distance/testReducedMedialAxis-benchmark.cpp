@@ -0,0 +1,153 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testReducedMedialAxis-benchmark.cpp
+ * @ingroup Tests
+ *
+ * @author DGtal development team (\c dgtal-devel@lists.gforge.liris.cnrs.fr )
+ *
+ * @date 2026/10/19
+ *
+ * Benchmark of the power map, reduced medial axis and reverse
+ * distance transformation on 3D shapes (run with OpenMP to measure
+ * the parallel passes).
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <string>
+#include "DGtal/base/Common.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/images/ImageContainerBySTLVector.h"
+#include "DGtal/images/SimpleThresholdForegroundPredicate.h"
+#include "DGtal/geometry/volumes/distance/DistanceTransformation.h"
+#include "DGtal/geometry/volumes/distance/PowerMap.h"
+#include "DGtal/geometry/volumes/distance/ReducedMedialAxis.h"
+#include "DGtal/geometry/volumes/distance/ReverseDistanceTransformation.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for benchmarking the reduced medial axis.
+///////////////////////////////////////////////////////////////////////////////
+
+/**
+ * Computes the medial axis of a 3D shape (union of balls and of a
+ * torus) in a cube of side @a n and reconstructs it.
+ */
+bool runABenchmark( int n )
+{
+  typedef ImageContainerBySTLVector<Z3i::Domain, DGtal::int64_t> WeightImage;
+  typedef PowerMap<WeightImage, Z3i::L2PowerMetric> Power;
+  typedef ReducedMedialAxis<Power> RMA;
+
+  trace.beginBlock( "Benchmark on a " + std::to_string( n ) + "^3 domain" );
+  Z3i::Domain domain( Z3i::Point::diagonal( 0 ), Z3i::Point::diagonal( n - 1 ) );
+  const double r = n / 4.0;
+  const Z3i::RealPoint c( n / 2.0, n / 2.0, n / 2.0 );
+  auto inside = [&] ( const Z3i::Point & p )
+    {
+      const double x = p[ 0 ] - c[ 0 ], y = p[ 1 ] - c[ 1 ], z = p[ 2 ] - c[ 2 ];
+      const double q = std::sqrt( x * x + y * y ) - 1.2 * r;
+      return ( q * q + z * z <= r * r / 4.0 )
+        || ( ( x - r ) * ( x - r ) + y * y + z * z <= r * r )
+        || ( ( x + r ) * ( x + r ) + y * y + ( z - r / 2.0 ) * ( z - r / 2.0 )
+             <= r * r / 2.0 );
+    };
+
+  WeightImage shape( domain );
+  unsigned int shapeSize = 0;
+  for ( auto const & p : domain )
+    {
+      const bool in = inside( p );
+      shape.setValue( p, in ? 1 : 0 );
+      shapeSize += in ? 1 : 0;
+    }
+  trace.info() << shapeSize << " voxels." << std::endl;
+
+  trace.beginBlock( "Squared distance transformation" );
+  typedef functors::SimpleThresholdForegroundPredicate<WeightImage> Predicate;
+  Predicate predicate( shape, 0 );
+  typedef DistanceTransformation<Z3i::Space, Predicate, Z3i::L2Metric> DT;
+  DT dt( &domain, &predicate, &Z3i::l2Metric );
+  WeightImage weights( domain );
+  for ( auto const & p : domain )
+    {
+      const Z3i::Vector v = p - dt.getVoronoiVector( p );
+      weights.setValue( p, shape( p ) != 0 ? v.dot( v ) : 0 );
+    }
+  trace.endBlock();
+
+  Z3i::L2PowerMetric l2power;
+  trace.beginBlock( "Power map" );
+  Power power( &domain, &weights, &l2power );
+  trace.endBlock();
+
+  trace.beginBlock( "Reduced medial axis (image)" );
+  RMA::Type rdma = RMA::getReducedMedialAxisFromPowerMap( power );
+  trace.endBlock();
+
+  trace.beginBlock( "Reduced medial axis (sparse balls)" );
+  const RMA::BallRange balls = RMA::getReducedMedialAxisBalls( power );
+  trace.endBlock();
+  trace.info() << balls.size() << " maximal balls." << std::endl;
+
+  WeightImage medialAxis( domain );
+  for ( auto const & p : domain )
+    medialAxis.setValue( p, 0 );
+  for ( auto const & ball : balls )
+    medialAxis.setValue( ball.first, ball.second );
+
+  trace.beginBlock( "Reverse distance transformation" );
+  ReverseDistanceTransformation<WeightImage, Z3i::L2PowerMetric>
+    rdt( &domain, &medialAxis, &l2power );
+  trace.endBlock();
+
+  trace.beginBlock( "Reconstruction check" );
+  bool ok = true;
+  for ( auto const & p : domain )
+    ok = ok && ( ( rdt( p ) < 0 ) == ( shape( p ) != 0 ) );
+  trace.endBlock();
+  trace.info() << "Reconstruction " << ( ok ? "exact" : "WRONG" ) << std::endl;
+
+  trace.endBlock();
+  return ok;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc, char** argv )
+{
+  trace.beginBlock ( "Benchmarking class ReducedMedialAxis" );
+  trace.info() << "Args:";
+  for ( int i = 0; i < argc; ++i )
+    trace.info() << " " << argv[ i ];
+  trace.info() << endl;
+
+  const int n = argc > 1 ? std::atoi( argv[ 1 ] ) : 128;
+  bool res = runABenchmark( n / 2 ) && runABenchmark( n );
+  trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
+  trace.endBlock();
+  return res ? 0 : 1;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
@@ -35,6 +35,10 @@
 #include "DGtal/helpers/StdDefs.h"
 #include "DGtal/geometry/volumes/distance/PowerMap.h"
 #include "DGtal/geometry/volumes/distance/ReducedMedialAxis.h"
+#include "DGtal/geometry/volumes/distance/ReverseDistanceTransformation.h"
+#include "DGtal/geometry/volumes/distance/DistanceTransformation.h"
+#include "DGtal/images/ImageContainerBySTLVector.h"
+#include "DGtal/images/SimpleThresholdForegroundPredicate.h"
 #include "DGtal/geometry/volumes/distance/ExactPredicateLpPowerSeparableMetric.h"
 #include "DGtal/kernel/sets/DigitalSetDomain.h"
 #include "DGtal/kernel/sets/DigitalSetBySTLSet.h"
@@ -155,6 +159,84 @@ bool testReducedMedialAxis( std::array<bool, 2> const& aPeriodicity = {{ false,
   return nbok == nb;
 }
 
+/**
+ * Sparse medial axis of a 3D shape, compared to the medial axis
+ * image, and reconstruction of the shape by the reverse distance
+ * transformation of the maximal balls.
+ */
+bool testReducedMedialAxisBalls()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  trace.beginBlock ( "Testing sparse medial axis and reconstruction in 3D ..." );
+
+  typedef ImageContainerBySTLVector<Z3i::Domain, DGtal::int64_t> WeightImage;
+  typedef PowerMap<WeightImage, Z3i::L2PowerMetric> Power;
+  typedef ReducedMedialAxis<Power> RMA;
+
+  Z3i::Domain domain( Z3i::Point( 0, 0, 0 ), Z3i::Point( 30, 24, 20 ) );
+  const Z3i::Point c1( 10, 12, 10 ), c2( 20, 12, 10 );
+  auto inside = [&] ( const Z3i::Point & p )
+    {
+      return ( p - c1 ).dot( p - c1 ) <= 49 || ( p - c2 ).dot( p - c2 ) <= 36
+        || ( p[ 0 ] >= 6 && p[ 0 ] <= 24 && p[ 1 ] >= 10 && p[ 1 ] <= 14
+             && p[ 2 ] >= 4 && p[ 2 ] <= 6 );
+    };
+
+  // Squared distance to the background.
+  WeightImage shape( domain );
+  for ( auto const & p : domain )
+    shape.setValue( p, inside( p ) ? 1 : 0 );
+  typedef functors::SimpleThresholdForegroundPredicate<WeightImage> Predicate;
+  Predicate predicate( shape, 0 );
+  typedef DistanceTransformation<Z3i::Space, Predicate, Z3i::L2Metric> DT;
+  DT dt( &domain, &predicate, &Z3i::l2Metric );
+  WeightImage weights( domain );
+  for ( auto const & p : domain )
+    {
+      const Z3i::Vector v = p - dt.getVoronoiVector( p );
+      weights.setValue( p, inside( p ) ? v.dot( v ) : 0 );
+    }
+
+  Z3i::L2PowerMetric l2power;
+  Power power( &domain, &weights, &l2power );
+  const RMA::BallRange balls = RMA::getReducedMedialAxisBalls( power );
+  RMA::Type rdma = RMA::getReducedMedialAxisFromPowerMap( power );
+  trace.info() << balls.size() << " maximal balls." << std::endl;
+
+  WeightImage medialAxis( domain );
+  for ( auto const & p : domain )
+    medialAxis.setValue( p, 0 );
+  for ( auto const & ball : balls )
+    medialAxis.setValue( ball.first, ball.second );
+  bool sameAsImage = true;
+  unsigned int shapeSize = 0;
+  for ( auto const & p : domain )
+    {
+      sameAsImage = sameAsImage && ( rdma( p ) == medialAxis( p ) );
+      shapeSize  += inside( p ) ? 1 : 0;
+    }
+  ++nb; nbok += sameAsImage ? 1 : 0;
+  ++nb; nbok += ( ! balls.empty() && balls.size() < shapeSize ) ? 1 : 0;
+  bool sorted = true;
+  for ( std::size_t i = 1; i < balls.size(); ++i )
+    sorted = sorted && ! ( balls[ i ].first[ 2 ] < balls[ i-1 ].first[ 2 ] );
+  ++nb; nbok += sorted ? 1 : 0;
+
+  // Reconstruction from the maximal balls only.
+  ReverseDistanceTransformation<WeightImage, Z3i::L2PowerMetric> rdt( &domain, &medialAxis, &l2power );
+  bool sameShape = true;
+  for ( auto const & p : domain )
+    sameShape = sameShape && ( ( rdt( p ) < 0 ) == inside( p ) );
+  ++nb; nbok += sameShape ? 1 : 0;
+
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "image, sparse, order, reconstruction" << std::endl;
+  trace.endBlock();
+  return nbok == nb;
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // Standard services - public :
 
@@ -171,6 +253,7 @@ int main( int argc, char** argv )
     && testReducedMedialAxis( {{ true,  false }} )
     && testReducedMedialAxis( {{ false, true  }} )
     && testReducedMedialAxis( {{ true,  true  }} )
+    && testReducedMedialAxisBalls()
   ; // && ... other tests
 
   trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
@@ -675,6 +675,92 @@ bool testSimple4D()
 }
 
 
+/**
+ * Random edits of the sites of a Voronoi map, checking that the
+ * updated map gives the distances of a full recomputation.
+ */
+template <typename Set, typename Metric>
+bool testUpdateFromEdits( const typename Set::Domain & domain,
+                          const Metric & metric,
+                          const std::string & name )
+{
+  typedef typename Set::Point Point;
+  typedef VoronoiMap<typename Set::Space, Set, Metric> Voro;
+
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  trace.beginBlock( "Incremental update " + name );
+  const Point extent = domain.upperBound() - domain.lowerBound() + Point::diagonal( 1 );
+  auto randomPoint = [&] ()
+    {
+      Point p;
+      for ( Dimension i = 0; i < Point::dimension; ++i )
+        p[ i ] = domain.lowerBound()[ i ] + rand() % extent[ i ];
+      return p;
+    };
+
+  // The point predicate is the set of non-site points.
+  Set mySet( domain );
+  mySet.assignFromComplement( Set( domain ) );
+  std::vector<Point> sites;
+  for ( unsigned int i = 0; i < 12; ++i )
+    {
+      sites.push_back( randomPoint() );
+      mySet.erase( sites.back() );
+    }
+  Voro voro( domain, mySet, metric );
+
+  for ( unsigned int step = 0; step < 20; ++step )
+    {
+      std::vector<Point> changed;
+      const unsigned int nbEdits = 1 + rand() % 3;
+      for ( unsigned int k = 0; k < nbEdits; ++k )
+        if ( ( sites.size() > 2 ) && ( rand() % 2 == 0 ) )
+          {
+            const std::size_t i = rand() % sites.size();
+            if ( mySet( sites[ i ] ) ) continue;
+            mySet.insert( sites[ i ] );
+            changed.push_back( sites[ i ] );
+            sites.erase( sites.begin() + i );
+          }
+        else
+          {
+            const Point p = randomPoint();
+            if ( ! mySet( p ) ) continue;
+            mySet.erase( p );
+            changed.push_back( p );
+            sites.push_back( p );
+          }
+
+      const std::size_t nbUpdated = voro.update( changed );
+      const Voro full( domain, mySet, metric );
+      bool ok = true;
+      for ( auto const & p : domain )
+        ok = ok && ( metric( p, voro( p ) ) == metric( p, full( p ) ) );
+      trace.info() << "step " << step << ": " << changed.size() << " edits, "
+                   << nbUpdated << " points updated" << std::endl;
+      nbok += ok ? 1 : 0;
+      nb++;
+    }
+  trace.info() << "(" << nbok << "/" << nb << ") updates" << std::endl;
+  trace.endBlock();
+  return nbok == nb;
+}
+
+bool testUpdate()
+{
+  Z2i::Domain domain2( Z2i::Point( -20, -10 ), Z2i::Point( 30, 25 ) );
+  Z3i::Domain domain3( Z3i::Point( 0, 0, 0 ), Z3i::Point( 15, 20, 12 ) );
+  ExactPredicateLpSeparableMetric<Z2i::Space, 1> l1;
+  ExactPredicateLpSeparableMetric<Z2i::Space, 3> l3;
+  return testUpdateFromEdits<Z2i::DigitalSet>( domain2, Z2i::l2Metric, "l_2 2D" )
+    && testUpdateFromEdits<Z2i::DigitalSet>( domain2, l1, "l_1 2D" )
+    && testUpdateFromEdits<Z2i::DigitalSet>( domain2, l3, "l_3 2D" )
+    && testUpdateFromEdits<Z3i::DigitalSet>( domain3, Z3i::l2Metric, "l_2 3D" );
+}
+
+
 ///////////////////////////////////////////////////////////////////////////////
 // Standard services - public :
 
@@ -696,6 +782,7 @@ int main( int argc, char** argv )
     && testSimple3D()
     && testSimpleRandom3D()
     && testSimple4D()
+    && testUpdate()
     ; // && ... other tests
 
   trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
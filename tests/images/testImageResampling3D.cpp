@@ -0,0 +1,250 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testImageResampling3D.cpp
+ * @ingroup Tests
+ *
+ * @author DGtal development team (\c dgtal-devel@lists.gforge.liris.cnrs.fr )
+ *
+ * @date 2026/10/19
+ *
+ * Functions for testing class ImageResampling3D.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <cmath>
+#include <iostream>
+#include "DGtal/base/Common.h"
+#include "ConfigTest.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/images/ImageSelector.h"
+#include "DGtal/images/ImageContainerBySTLVector.h"
+#include "DGtal/images/ImageContainerBySTLMap.h"
+#include "DGtal/images/ImageFactoryFromImage.h"
+#include "DGtal/images/TiledImage.h"
+#include "DGtal/images/RigidTransformation3D.h"
+#include "DGtal/images/ImageResampling3D.h"
+#include "DGtal/io/readers/PGMReader.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+using namespace Z3i;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class ImageResampling3D.
+///////////////////////////////////////////////////////////////////////////////
+
+typedef ImageContainerBySTLVector<Domain, unsigned char> Image;
+typedef ImageResampling3D<Space> Resampling;
+
+/**
+ * Nearest neighbor resampling with a rigid transformation, compared
+ * with the point-wise BackwardRigidTransformation3D, for an image
+ * stored in a vector and for a generic image.
+ */
+bool testNearestRigid()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+  trace.beginBlock ( "Nearest neighbor rigid resampling..." );
+  typedef functors::ForwardRigidTransformation3D<Space> ForwardTrans;
+  typedef functors::BackwardRigidTransformation3D<Space> BackwardTrans;
+  typedef functors::DomainRigidTransformation3D<Domain, ForwardTrans> DomainTrans;
+  Image image = PGMReader<Image>::importPGM3D( testPath + "samples/cat10.pgm3d" );
+  ForwardTrans forwardTrans( RealPoint( 5, 5, 5 ), RealVector( 1, 0, 1 ), M_PI_4, RealVector( 3, -3, 3 ) );
+  BackwardTrans backwardTrans( RealPoint( 5, 5, 5 ), RealVector( 1, 0, 1 ), M_PI_4, RealVector( 3, -3, 3 ) );
+  DomainTrans domainTrans( forwardTrans );
+  DomainTrans::Bounds bounds = domainTrans( image.domain() );
+  Domain domain( bounds.first, bounds.second );
+  Resampling resampling( RealPoint( 5, 5, 5 ), RealVector( 1, 0, 1 ), M_PI_4, RealVector( 3, -3, 3 ) );
+  trace.info() << resampling << std::endl;
+
+  Image output( domain );
+  resampling.resample( image, output );
+  ImageContainerBySTLMap<Domain, unsigned char> generic( domain, 1 );
+  resampling.resample( image, generic, Resampling::NEAREST, 7 );
+
+  // Preimages halfway between two integers may be rounded differently.
+  typedef functors::BackwardRigidTransformation3D<Space, RealPoint, RealPoint,
+                                                  functors::Identity> RealBackwardTrans;
+  RealBackwardTrans realBackwardTrans( RealPoint( 5, 5, 5 ), RealVector( 1, 0, 1 ),
+                                       M_PI_4, RealVector( 3, -3, 3 ) );
+  unsigned int nbDiff = 0;
+  unsigned int nbGenericDiff = 0;
+  unsigned int nbInside = 0;
+  unsigned int nbTies = 0;
+  for ( Domain::ConstIterator it = domain.begin(), itE = domain.end(); it != itE; ++it )
+    {
+      const RealPoint rq = realBackwardTrans( RealPoint( (*it)[ 0 ], (*it)[ 1 ], (*it)[ 2 ] ) );
+      bool tie = false;
+      for ( Dimension i = 0; i < 3; ++i )
+        tie = tie || ( std::fabs( rq[ i ] - std::floor( rq[ i ] ) - 0.5 ) < 1e-9 );
+      if ( tie ) { ++nbTies; continue; }
+      const Point q = backwardTrans( *it );
+      const bool inside = image.domain().isInside( q );
+      nbInside += inside ? 1 : 0;
+      nbDiff += ( output( *it ) == ( inside ? image( q ) : 0 ) ) ? 0 : 1;
+      nbGenericDiff += ( generic( *it ) == ( inside ? image( q ) : 7 ) ) ? 0 : 1;
+    }
+  trace.info() << "domain=" << domain << " inside=" << nbInside
+               << " ties=" << nbTies << " diff=" << nbDiff << " generic diff=" << nbGenericDiff << std::endl;
+  nbok += ( nbInside > 0 ) && ( nbDiff == 0 ) ? 1 : 0;
+  nb++;
+  nbok += ( nbGenericDiff == 0 ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") " << std::endl;
+  trace.endBlock();
+  return nbok == nb;
+}
+
+/**
+ * The identity copies the image, whatever the interpolation.
+ */
+bool testIdentity()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+  trace.beginBlock ( "Identity resampling..." );
+  Image image = PGMReader<Image>::importPGM3D( testPath + "samples/cat10.pgm3d" );
+  Resampling identity;
+  Image nearest( image.domain() );
+  Image trilinear( image.domain() );
+  identity.resample( image, nearest, Resampling::NEAREST );
+  identity.resample( image, trilinear, Resampling::TRILINEAR );
+  nbok += std::equal( image.begin(), image.end(), nearest.begin() ) ? 1 : 0;
+  nb++;
+  nbok += std::equal( image.begin(), image.end(), trilinear.begin() ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") " << std::endl;
+  trace.endBlock();
+  return nbok == nb;
+}
+
+/**
+ * Trilinear interpolation is exact on affine functions: an affine
+ * image resampled with an affine transformation is compared with the
+ * composition of both.
+ */
+bool testTrilinearAffine()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+  trace.beginBlock ( "Trilinear affine resampling..." );
+  typedef ImageContainerBySTLVector<Domain, double> RealImage;
+  Domain domain( Point( -10, -8, -6 ), Point( 20, 18, 16 ) );
+  RealImage image( domain );
+  for ( Domain::ConstIterator it = domain.begin(), itE = domain.end(); it != itE; ++it )
+    image.setValue( *it, 2.0 * (*it)[ 0 ] - 3.0 * (*it)[ 1 ] + 0.5 * (*it)[ 2 ] + 1.0 );
+  Resampling::Matrix A;
+  A.setComponent( 0, 0, 0.8 );  A.setComponent( 0, 1, -0.3 ); A.setComponent( 0, 2, 0.1 );
+  A.setComponent( 1, 0, 0.25 ); A.setComponent( 1, 1, 0.9 );  A.setComponent( 1, 2, -0.2 );
+  A.setComponent( 2, 0, -0.1 ); A.setComponent( 2, 1, 0.15 ); A.setComponent( 2, 2, 1.1 );
+  Resampling resampling( A, RealVector( 1.3, -2.7, 0.4 ) );
+  RealImage output( domain );
+  resampling.resample( image, output, Resampling::TRILINEAR, -1000.0 );
+  double maxError = 0.0;
+  unsigned int nbInside = 0;
+  unsigned int nbOutsideOk = 0;
+  unsigned int nbOutside = 0;
+  const Point lo = domain.lowerBound();
+  const Point up = domain.upperBound();
+  for ( Domain::ConstIterator it = domain.begin(), itE = domain.end(); it != itE; ++it )
+    {
+      const RealPoint q = resampling( *it );
+      if ( q[ 0 ] >= lo[ 0 ] && q[ 1 ] >= lo[ 1 ] && q[ 2 ] >= lo[ 2 ]
+           && q[ 0 ] < up[ 0 ] && q[ 1 ] < up[ 1 ] && q[ 2 ] < up[ 2 ] )
+        {
+          const double expected = 2.0 * q[ 0 ] - 3.0 * q[ 1 ] + 0.5 * q[ 2 ] + 1.0;
+          maxError = std::max( maxError, std::fabs( output( *it ) - expected ) );
+          ++nbInside;
+        }
+      else if ( q[ 0 ] < lo[ 0 ] - 1 || q[ 1 ] < lo[ 1 ] - 1 || q[ 2 ] < lo[ 2 ] - 1
+                || q[ 0 ] > up[ 0 ] + 1 || q[ 1 ] > up[ 1 ] + 1 || q[ 2 ] > up[ 2 ] + 1 )
+        {
+          nbOutsideOk += ( std::fabs( output( *it ) + 1000.0 ) < 1e-9 ) ? 1 : 0;
+          ++nbOutside;
+        }
+    }
+  trace.info() << "inside=" << nbInside << " max error=" << maxError
+               << " outside=" << nbOutsideOk << "/" << nbOutside << std::endl;
+  nbok += ( nbInside > 0 ) && ( maxError < 1e-9 ) ? 1 : 0;
+  nb++;
+  nbok += ( nbOutside > 0 ) && ( nbOutsideOk == nbOutside ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") " << std::endl;
+  trace.endBlock();
+  return nbok == nb;
+}
+
+/**
+ * An image read through a cache (TiledImage), which is resampled by a
+ * single thread, gives the same result as the image stored in a
+ * vector.
+ */
+bool testTiledInput()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+  trace.beginBlock ( "Resampling of a tiled image..." );
+  typedef ImageFactoryFromImage<Image> Factory;
+  typedef Factory::OutputImage Tile;
+  typedef ImageCacheReadPolicyFIFO<Tile, Factory> ReadPolicy;
+  typedef ImageCacheWritePolicyWT<Tile, Factory> WritePolicy;
+  typedef TiledImage<Image, Factory, ReadPolicy, WritePolicy> Tiled;
+  Image image = PGMReader<Image>::importPGM3D( testPath + "samples/cat10.pgm3d" );
+  Factory factory( image );
+  ReadPolicy readPolicy( factory, 2 );
+  WritePolicy writePolicy( factory );
+  Tiled tiled( factory, readPolicy, writePolicy, 4 );
+  Resampling resampling( RealPoint( 5, 5, 5 ), RealVector( 1, 0, 1 ), M_PI_4, RealVector( 1, -1, 1 ) );
+  Image expected( image.domain() );
+  Image output( image.domain() );
+  resampling.resample( image, expected, Resampling::TRILINEAR, 3 );
+  resampling.resample( tiled, output, Resampling::TRILINEAR, 3 );
+  nbok += std::equal( expected.begin(), expected.end(), output.begin() ) ? 1 : 0;
+  nb++;
+  resampling.resample( image, expected, Resampling::NEAREST, 3 );
+  resampling.resample( tiled, output, Resampling::NEAREST, 3 );
+  nbok += std::equal( expected.begin(), expected.end(), output.begin() ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") " << std::endl;
+  trace.endBlock();
+  return nbok == nb;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc, char** argv )
+{
+  trace.beginBlock ( "Testing class ImageResampling3D" );
+  trace.info() << "Args:";
+  for ( int i = 0; i < argc; ++i )
+    trace.info() << " " << argv[ i ];
+  trace.info() << endl;
+
+  bool res = testNearestRigid() && testIdentity() && testTrilinearAffine()
+    && testTiledInput();
+  trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
+  trace.endBlock();
+  return res ? 0 : 1;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
@@ -33,6 +33,7 @@
 #include "ConfigTest.h"
 #include "DGtal/helpers/StdDefs.h"
 #include "DGtal/io/boards/Board3D.h"
+#include "DGtal/base/ConstRangeAdapter.h"
 ///////////////////////////////////////////////////////////////////////////////
 
 using namespace std;
@@ -177,6 +178,227 @@ bool testShapes()
 
   
 
+bool testCubeInstances()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+  trace.beginBlock ( "Testing groups of cubes ..." );
+
+  Domain domain( Point( -2, -3, 0 ), Point( 5, 4, 6 ) );
+  DigitalSet shape_set( domain );
+  for ( Domain::ConstIterator it = domain.begin(); it != domain.end(); ++it )
+    if ( ( (*it)[ 0 ] + (*it)[ 1 ] + (*it)[ 2 ] ) % 3 == 0 )
+      shape_set.insertNew( *it );
+
+  // per cube reference
+  Board3D<> board;
+  board << CustomColors3D( Color( 250, 0, 0 ), Color( 250, 0, 0 ) );
+  for ( DigitalSet::ConstIterator it = shape_set.begin(); it != shape_set.end(); ++it )
+    board.addCube( board.embed( *it ) );
+  Mesh<RealPoint> mesh( true );
+  board >> mesh;
+
+  // the digital set is drawn as one group
+  Board3D<> board2;
+  board2 << CustomColors3D( Color( 250, 0, 0 ), Color( 250, 0, 0 ) );
+  board2 << shape_set;
+  Mesh<RealPoint> mesh2( true );
+  board2 >> mesh2;
+
+  bool same = ( mesh.nbVertex() == mesh2.nbVertex() )
+    && ( mesh.nbFaces() == mesh2.nbFaces() )
+    && ( mesh.nbFaces() == 6 * shape_set.size() );
+  for ( unsigned int i = 0; same && i < mesh.nbVertex(); ++i )
+    same = ( mesh.getVertex( i ) == mesh2.getVertex( i ) );
+  for ( unsigned int i = 0; same && i < mesh.nbFaces(); ++i )
+    same = ( mesh.getFaceColor( i ) == mesh2.getFaceColor( i ) );
+  nbok += same ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "digital set as a group == cube by cube" << std::endl;
+  nbok += ( ( board.myBoundingPtLow[ 0 ] == board2.myBoundingPtLow[ 0 ] )
+            && ( board.myBoundingPtUp[ 2 ] == board2.myBoundingPtUp[ 2 ] ) ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "same bounding box" << std::endl;
+
+  // colors given per point: the group switches to per cube colors
+  Board3D<> board3;
+  board3.createNewCubeList();
+  board3.addColoredCubes( shape_set.begin(), shape_set.end(),
+                          [] ( const Point & p )
+                          { return p[ 2 ] < 3 ? Color::Red : Color::Blue; }, 0.5 );
+  Mesh<RealPoint> mesh3( true );
+  board3 >> mesh3;
+  bool colors = mesh3.nbFaces() == 6 * shape_set.size();
+  unsigned int i = 0;
+  for ( DigitalSet::ConstIterator it = shape_set.begin();
+        colors && it != shape_set.end(); ++it, i += 6 )
+    colors = ( mesh3.getFaceColor( i ) == ( (*it)[ 2 ] < 3 ? Color::Red : Color::Blue ) )
+      && ( mesh3.getVertex( 8 * i / 6 )[ 0 ] == (*it)[ 0 ] - 0.25 );
+  nbok += colors ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "per cube colors and width" << std::endl;
+
+  board2.saveOBJ( "dgtalBoard3D-cubeInstances.obj" );
+  board2.clear();
+  Mesh<RealPoint> mesh4( true );
+  board2 >> mesh4;
+  nbok += ( mesh4.nbFaces() == 0 ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "clear" << std::endl;
+
+  trace.endBlock();
+  return nbok == nb;
+}
+
+/// Gives access to the groups of a Board3D in order to sort them as
+/// Viewer3D does.
+struct SortableBoard3D : public Board3D<Space,KSpace>
+{
+  SortableBoard3D( const KSpace & k ) : Board3D<Space,KSpace>( k ) {}
+  void sortFarthestFirst( const RealPoint & p )
+  {
+    for ( auto & group : myCubeInstancesMap )
+      group.second.sortFarthestFirst( p );
+    for ( auto & group : mySurfelInstancesList )
+      group.sortFarthestFirst( p );
+  }
+};
+
+/// @return 'true' if the bounding box centers of the successive
+/// blocks of @a nbVertices vertices of @a mesh (a cube or a prism) are
+/// sorted by decreasing distance to @a p (the retracted face of a
+/// signed prism moves its box center by less than 0.01).
+bool farthestFirst( const Mesh<RealPoint> & mesh, unsigned int nbVertices,
+                    const RealPoint & p )
+{
+  double prev = std::numeric_limits<double>::max();
+  for ( unsigned int i = 0; i + nbVertices <= mesh.nbVertex(); i += nbVertices )
+    {
+      RealPoint low = mesh.getVertex( i );
+      RealPoint up  = low;
+      for ( unsigned int j = 1; j < nbVertices; ++j )
+        {
+          low = low.inf( mesh.getVertex( i + j ) );
+          up  = up.sup( mesh.getVertex( i + j ) );
+        }
+      const double d = ( ( low + up ) / 2.0 - p ).norm();
+      if ( d > prev + 0.01 ) return false;
+      prev = d;
+    }
+  return true;
+}
+
+bool testSurfelInstances()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+  trace.beginBlock ( "Testing groups of surfels ..." );
+
+  KSpace k;
+  k.init( Point( -10, -10, -10 ), Point( 10, 10, 10 ), true );
+  Domain domain( Point( -4, -4, -4 ), Point( 4, 4, 4 ) );
+  DigitalSet shape_set( domain );
+  for ( Domain::ConstIterator it = domain.begin(); it != domain.end(); ++it )
+    if ( (*it).norm() <= 3.5 )
+      shape_set.insertNew( *it );
+  // boundary surfels, with both signs
+  std::vector<SCell> surfels;
+  for ( DigitalSet::ConstIterator it = shape_set.begin(); it != shape_set.end(); ++it )
+    {
+      const SCell spel = k.sSpel( *it, KSpace::POS );
+      for ( Dimension d = 0; d < 3; ++d )
+        for ( int dir = 0; dir < 2; ++dir )
+          {
+            Point q = *it;
+            q[ d ] += dir == 0 ? -1 : 1;
+            if ( ! shape_set( q ) )
+              surfels.push_back( k.sIncident( spel, d, dir == 1 ) );
+          }
+    }
+  typedef ConstRangeAdapter< std::vector<SCell>::const_iterator,
+                             functors::Identity, SCell > SCellsRange;
+  SCellsRange range( surfels.begin(), surfels.end(), functors::Identity() );
+
+  bool same = true;
+  for ( const std::string mode : { "", "Highlighted", "Transparent" } )
+    {
+      // per surfel reference
+      Board3D<Space,KSpace> board( k );
+      board << SetMode3D( surfels[ 0 ].className(), mode );
+      board << CustomColors3D( Color( 0, 0, 250 ), Color( 0, 0, 250 ) );
+      for ( std::vector<SCell>::const_iterator it = surfels.begin(); it != surfels.end(); ++it )
+        board << *it;
+      Mesh<RealPoint> mesh( true );
+      board >> mesh;
+
+      // the range is drawn as one group
+      Board3D<Space,KSpace> board2( k );
+      board2 << SetMode3D( surfels[ 0 ].className(), mode );
+      board2 << CustomColors3D( Color( 0, 0, 250 ), Color( 0, 0, 250 ) );
+      board2 << range;
+      Mesh<RealPoint> mesh2( true );
+      board2 >> mesh2;
+
+      same = same && ( mesh.nbVertex() == mesh2.nbVertex() )
+        && ( mesh.nbFaces() == mesh2.nbFaces() )
+        && ( mesh.nbFaces() == 6 * surfels.size() )
+        && ( board.myBoundingPtLow[ 0 ] == board2.myBoundingPtLow[ 0 ] )
+        && ( board.myBoundingPtUp[ 2 ] == board2.myBoundingPtUp[ 2 ] )
+        && ( board2.getFillColor() == Color( 0, 0, 250 ) );
+      for ( unsigned int i = 0; same && i < mesh.nbVertex(); ++i )
+        same = ( mesh.getVertex( i ) - mesh2.getVertex( i ) ).norm() < 1e-12;
+      for ( unsigned int i = 0; same && i < mesh.nbFaces(); ++i )
+        same = ( mesh.getFaceColor( i ) == mesh2.getFaceColor( i ) );
+      if ( mode == "Transparent" )
+        board2.saveOBJ( "dgtalBoard3D-surfelInstances.obj" );
+    }
+  nbok += same ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "surfels as a group == surfel by surfel" << std::endl;
+
+  // groups are sorted from a viewpoint (the camera in Viewer3D)
+  const RealPoint eye( 20.0, -7.0, 11.0 );
+  SortableBoard3D board3( k );
+  board3 << SetMode3D( shape_set.className(), "PavingTransp" );
+  board3 << shape_set;
+  board3.addSurfels( surfels.begin(), surfels.end() );
+  board3.createNewCubeList();
+  board3.addColoredCubes( shape_set.begin(), shape_set.end(),
+                          [] ( const Point & p )
+                          { return p[ 2 ] < 0 ? Color::Red : Color::Blue; } );
+  board3.sortFarthestFirst( eye );
+  Mesh<RealPoint> mesh3( true );
+  board3 >> mesh3;
+  const unsigned int nbSurfelVertices = 24 * surfels.size();
+  Mesh<RealPoint> prisms( true ), cubes( true ), coloredCubes( true );
+  for ( unsigned int i = 0; i < mesh3.nbVertex(); ++i )
+    ( i < nbSurfelVertices ? prisms
+      : i < nbSurfelVertices + 8 * shape_set.size() ? cubes
+      : coloredCubes ).addVertex( mesh3.getVertex( i ) );
+  bool sorted = ( mesh3.nbFaces() == 6 * surfels.size() + 12 * shape_set.size() )
+    && farthestFirst( prisms, 24, eye )
+    && farthestFirst( cubes, 8, eye )
+    && farthestFirst( coloredCubes, 8, eye );
+  for ( unsigned int i = 0; sorted && i < coloredCubes.nbVertex(); i += 8 )
+    {
+      const unsigned int f = 6 * surfels.size() + 6 * shape_set.size() + 6 * i / 8;
+      const bool below = ( coloredCubes.getVertex( i )[ 2 ] < 0 );
+      sorted = ( mesh3.getFaceColor( f ) == ( below ? Color::Red : Color::Blue ) );
+    }
+  nbok += sorted ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "groups sorted from a viewpoint" << std::endl;
+
+  trace.endBlock();
+  return nbok == nb;
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // Standard services - public :
 
@@ -190,7 +412,9 @@ int main( int argc, char** argv )
 
 bool res = testBoard3D() && testQuadNorm()
                   && testNormaliation()
-                  && testShapes(); // && ... other tests
+                  && testShapes()
+                  && testCubeInstances()
+                  && testSurfelInstances(); // && ... other tests
   trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
   trace.endBlock();
   return res ? 0 : 1;
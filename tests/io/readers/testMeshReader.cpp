@@ -29,9 +29,13 @@
 
 ///////////////////////////////////////////////////////////////////////////////
 #include <iostream>
+#include <fstream>
+#include <sstream>
+#include <cstdlib>
 #include "DGtal/base/Common.h"
 #include "DGtal/shapes/Mesh.h"
 #include "DGtal/io/readers/MeshReader.h"
+#include "DGtal/io/writers/MeshWriter.h"
 #include "DGtal/helpers/StdDefs.h"
 
 #include "ConfigTest.h"
@@ -129,6 +133,233 @@ bool testMeshReader()
   return nbok == nb;
 }
 
+/**
+ * Checks that two meshes have the same vertices, faces and colors.
+ */
+template <typename TMesh>
+bool sameMesh( const TMesh & m1, const TMesh & m2, bool checkColors )
+{
+  if ( m1.nbVertex() != m2.nbVertex() || m1.nbFaces() != m2.nbFaces() )
+    return false;
+  for ( unsigned int i = 0; i < m1.nbVertex(); ++i )
+    if ( m1.getVertex( i ) != m2.getVertex( i ) )
+      return false;
+  for ( unsigned int i = 0; i < m1.nbFaces(); ++i )
+    if ( m1.getFace( i ) != m2.getFace( i )
+         || ( checkColors && m1.getFaceColor( i ) != m2.getFaceColor( i ) ) )
+      return false;
+  return true;
+}
+
+/**
+ * Writes and reads back OFF, OBJ and PLY files, with a mesh large
+ * enough to be parsed by several blocks.
+ */
+bool testMeshRoundTrip()
+{
+  typedef Z3i::RealPoint RealPoint;
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+  trace.beginBlock ( "Testing OFF, OBJ and PLY round trips ..." );
+
+  // A grid of quadrangles with random coordinates and colors.
+  const unsigned int n = 300;
+  Mesh<RealPoint> aMesh( true );
+  srand( 0 );
+  for ( unsigned int j = 0; j <= n; ++j )
+    for ( unsigned int i = 0; i <= n; ++i )
+      aMesh.addVertex( RealPoint( i + rand() / (double) RAND_MAX,
+                                  -1e-7 * rand(),
+                                  1e12 * rand() / (double) RAND_MAX ) );
+  for ( unsigned int j = 0; j < n; ++j )
+    for ( unsigned int i = 0; i < n; ++i )
+      aMesh.addQuadFace( j * ( n + 1 ) + i, j * ( n + 1 ) + i + 1,
+                         ( j + 1 ) * ( n + 1 ) + i + 1, ( j + 1 ) * ( n + 1 ) + i,
+                         Color( rand() % 256, rand() % 256, rand() % 256, 255 ) );
+  aMesh.addTriangularFace( 0, 1, n + 1, Color( 1, 2, 3, 4 ) );
+
+  // OFF with full precision: coordinates are read back exactly.
+  std::ofstream outOFF( "testMeshRoundTrip.off" );
+  outOFF.precision( 17 );
+  MeshWriter<RealPoint>::export2OFF( outOFF, aMesh, false );
+  outOFF.close();
+  Mesh<RealPoint> meshOFF;
+  nbok += MeshReader<RealPoint>::importOFFFile( "testMeshRoundTrip.off", meshOFF ) ? 1 : 0;
+  nb++;
+  nbok += sameMesh( aMesh, meshOFF, false ) ? 1 : 0;
+  nb++;
+
+  // OFF with the default precision and the colors, compared with the
+  // stream based parsing of the same file.
+  aMesh >> "testMeshRoundTrip2.off";
+  Mesh<RealPoint> meshOFF2( true );
+  MeshReader<RealPoint>::importOFFFile( "testMeshRoundTrip2.off", meshOFF2 );
+  std::ifstream inOFF( "testMeshRoundTrip2.off" );
+  std::string line;
+  for ( unsigned int k = 0; k < 3; ++k ) std::getline( inOFF, line );
+  bool sameAsStream = meshOFF2.nbVertex() == aMesh.nbVertex();
+  for ( unsigned int i = 0; i < aMesh.nbVertex() && sameAsStream; ++i )
+    {
+      RealPoint p;
+      inOFF >> p[ 0 ] >> p[ 1 ] >> p[ 2 ];
+      sameAsStream = ( p == meshOFF2.getVertex( i ) );
+    }
+  nbok += sameAsStream ? 1 : 0;
+  nb++;
+  bool sameColors = true;
+  for ( unsigned int i = 0; i < aMesh.nbFaces(); ++i )
+    sameColors = sameColors && ( meshOFF2.getFace( i ) == aMesh.getFace( i ) )
+      && ( std::abs( meshOFF2.getFaceColor( i ).red() - aMesh.getFaceColor( i ).red() ) <= 1 );
+  nbok += sameColors ? 1 : 0;
+  nb++;
+
+  // Inverted faces.
+  Mesh<RealPoint> meshInv;
+  MeshReader<RealPoint>::importOFFFile( "testMeshRoundTrip.off", meshInv, true );
+  Mesh<RealPoint>::MeshFace f = meshInv.getFace( 0 );
+  std::reverse( f.begin(), f.end() );
+  nbok += ( f == aMesh.getFace( 0 ) ) ? 1 : 0;
+  nb++;
+
+  // OBJ.
+  std::ofstream outOBJ( "testMeshRoundTrip.obj" );
+  outOBJ.precision( 17 );
+  MeshWriter<RealPoint>::export2OBJ( outOBJ, aMesh );
+  outOBJ.close();
+  Mesh<RealPoint> meshOBJ;
+  nbok += ( meshOBJ << "testMeshRoundTrip.obj" ) ? 1 : 0;
+  nb++;
+  nbok += sameMesh( aMesh, meshOBJ, false ) ? 1 : 0;
+  nb++;
+
+  // Binary PLY keeps coordinates and colors exactly.
+  aMesh >> "testMeshRoundTrip.ply";
+  Mesh<RealPoint> meshPLY( true );
+  nbok += ( meshPLY << "testMeshRoundTrip.ply" ) ? 1 : 0;
+  nb++;
+  nbok += sameMesh( aMesh, meshPLY, true ) ? 1 : 0;
+  nb++;
+
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "round trips" << std::endl;
+  trace.endBlock();
+  return nbok == nb;
+}
+
+/**
+ * Reads small OBJ and ascii PLY files with relative indices, comments
+ * and unusual number formats, and an OFF file whose records span
+ * several lines.
+ */
+bool testMeshFormats()
+{
+  typedef Z3i::RealPoint RealPoint;
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+  trace.beginBlock ( "Testing OBJ, ascii PLY and OFF ..." );
+
+  std::ofstream outOBJ( "testMeshFormats.obj" );
+  outOBJ << "# comment\n"
+         << "v 0 0 0\n"
+         << "vn 0 0 1\n"
+         << "vt 0.5 0.5\n"
+         << "v 1.5e0 -0 +2\n"
+         << "v .25 1E-2 -3.\n"
+         << "f 1/1/1 2//1 3\n"
+         << "v 0.1234567890123456789 1e300 -2.5e-310\r\n"
+         << "f -1 -2 -3 \r\n";
+  outOBJ.close();
+  Mesh<RealPoint> meshOBJ;
+  MeshReader<RealPoint>::importOBJFile( "testMeshFormats.obj", meshOBJ );
+  nbok += ( meshOBJ.nbVertex() == 4 && meshOBJ.nbFaces() == 2 ) ? 1 : 0;
+  nb++;
+  nbok += ( meshOBJ.getVertex( 1 ) == RealPoint( 1.5, 0, 2 )
+            && meshOBJ.getVertex( 2 ) == RealPoint( 0.25, 0.01, -3 )
+            && meshOBJ.getVertex( 3 ) == RealPoint( strtod( "0.1234567890123456789", 0 ),
+                                                    1e300, strtod( "-2.5e-310", 0 ) ) ) ? 1 : 0;
+  nb++;
+  Mesh<RealPoint>::MeshFace f1 = meshOBJ.getFace( 0 );
+  Mesh<RealPoint>::MeshFace f2 = meshOBJ.getFace( 1 );
+  nbok += ( f1.size() == 3 && f1[ 0 ] == 0 && f1[ 1 ] == 1 && f1[ 2 ] == 2
+            && f2.size() == 3 && f2[ 0 ] == 3 && f2[ 1 ] == 2 && f2[ 2 ] == 1 ) ? 1 : 0;
+  nb++;
+
+  std::ofstream outPLY( "testMeshFormats.ply" );
+  outPLY << "ply\n"
+         << "format ascii 1.0\n"
+         << "comment a triangle\n"
+         << "element vertex 3\n"
+         << "property float x\n"
+         << "property float y\n"
+         << "property float z\n"
+         << "property uchar intensity\n"
+         << "element face 1\n"
+         << "property list uchar int vertex_index\n"
+         << "property uchar red\n"
+         << "property uchar green\n"
+         << "property uchar blue\n"
+         << "end_header\n"
+         << "0 0 0 7\n1 0 0 7\n0 1 0 7\n"
+         << "3 0 1 2 255 128 0\n";
+  outPLY.close();
+  Mesh<RealPoint> meshPLY( true );
+  MeshReader<RealPoint>::importPLYFile( "testMeshFormats.ply", meshPLY );
+  nbok += ( meshPLY.nbVertex() == 3 && meshPLY.nbFaces() == 1
+            && meshPLY.getVertex( 2 ) == RealPoint( 0, 1, 0 )
+            && meshPLY.getFace( 0 ).size() == 3
+            && meshPLY.getFaceColor( 0 ) == Color( 255, 128, 0 ) ) ? 1 : 0;
+  nb++;
+
+  // OFF records spanning several lines.
+  std::ofstream outOFF( "testMeshFormats.off" );
+  outOFF << "OFF\n"
+         << "4 2 0\n"
+         << "0 0\n0\n"
+         << "1 0 0 255 0 0\n"
+         << "0 1 0\n"
+         << "0.5 0.5\n  2\n"
+         << "3\n0 1 2 1 0 0\n"
+         << "3 1 3\n2\n";
+  outOFF.close();
+  Mesh<RealPoint> meshOFF( true );
+  MeshReader<RealPoint>::importOFFFile( "testMeshFormats.off", meshOFF );
+  nbok += ( meshOFF.nbVertex() == 4 && meshOFF.nbFaces() == 2
+            && meshOFF.getVertex( 1 ) == RealPoint( 1, 0, 0 )
+            && meshOFF.getVertex( 3 ) == RealPoint( 0.5, 0.5, 2 )
+            && meshOFF.getFace( 0 ).size() == 3 && meshOFF.getFace( 1 )[ 2 ] == 2
+            && meshOFF.getFaceColor( 0 ) == Color( 255, 0, 0 ) ) ? 1 : 0;
+  nb++;
+
+  // The floating point flags of the stream are honored by MeshWriter.
+  bool sameAsStream = true;
+  const std::ios_base::fmtflags fields[] =
+    { std::ios_base::fixed, std::ios_base::scientific,
+      std::ios_base::scientific | std::ios_base::uppercase | std::ios_base::showpos };
+  for ( unsigned int k = 0; k < 3; ++k )
+    {
+      std::ostringstream written, expected;
+      written.setf( fields[ k ] );
+      expected.setf( fields[ k ] );
+      written.precision( 3 );
+      expected.precision( 3 );
+      MeshWriter<RealPoint>::export2OFF( written, meshOFF, false );
+      for ( unsigned int i = 0; i < meshOFF.nbVertex(); ++i )
+        {
+          const RealPoint p = meshOFF.getVertex( i );
+          expected << p[ 0 ] << " " << p[ 1 ] << " " << p[ 2 ] << "\n";
+        }
+      sameAsStream = sameAsStream
+        && written.str().find( expected.str() ) != std::string::npos;
+    }
+  nbok += sameAsStream ? 1 : 0;
+  nb++;
+
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "OBJ, PLY and OFF" << std::endl;
+  trace.endBlock();
+  return nbok == nb;
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // Standard services - public :
 
@@ -140,7 +371,7 @@ int main( int argc, char** argv )
     trace.info() << " " << argv[ i ];
   trace.info() << endl;
 
-  bool res = testMeshReader(); // && ... other tests
+  bool res = testMeshReader() && testMeshRoundTrip() && testMeshFormats(); // && ... other tests
   trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
   trace.endBlock();
   return res ? 0 : 1;
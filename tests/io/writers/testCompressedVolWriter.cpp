@@ -29,6 +29,8 @@
 
 ///////////////////////////////////////////////////////////////////////////////
 #include <iostream>
+#include <fstream>
+#include <iterator>
 #include "DGtal/base/Common.h"
 #include "ConfigTest.h"
 #include "DGtalCatch.h"
@@ -38,6 +40,10 @@
 #include "DGtal/io/writers/VolWriter.h"
 #include "DGtal/io/readers/VolReader.h"
 #include "DGtal/images/ImageContainerBySTLVector.h"
+#include "DGtal/images/ImageFactoryFromVol.h"
+#include "DGtal/images/TiledImage.h"
+#include "DGtal/io/readers/GenericReader.h"
+#include "DGtal/io/writers/GenericWriter.h"
 ///////////////////////////////////////////////////////////////////////////////
 
 using namespace std;
@@ -111,4 +117,84 @@ TEST_CASE( "Testing CompressedLongvol" )
     }
 }
 
+TEST_CASE( "Testing chunked Vol" )
+{
+  Domain domain(Point(-3,-2,-1), Point(40,37,50));
+  typedef ImageContainerBySTLVector<Domain, unsigned char> Image;
+  Image image(domain);
+  for(auto p: domain)
+    image.setValue(p, (unsigned char)( ( p[0] + 3*p[1] + 7*p[2] ) % 251 ) );
+
+  SECTION("Testing write/read of chunked Vol")
+    {
+      REQUIRE( VolWriter<Image>::exportChunkedVol("testchunked.vol", image, 16) );
+      Image read = VolReader<Image>::importVol("testchunked.vol");
+      REQUIRE( read.domain().lowerBound() == domain.lowerBound() );
+      REQUIRE( read.domain().upperBound() == domain.upperBound() );
+      REQUIRE( (checkImage(image,read) == true)) ;
+      REQUIRE( VolReader<Image>::importDomain("testchunked.vol").upperBound() == domain.upperBound() );
+    }
+
+  SECTION("Testing partial read of chunked and compressed Vol")
+    {
+      VolWriter<Image>::exportChunkedVol("testchunked.vol", image, 16);
+      VolWriter<Image>::exportVol("testz.vol", image);
+      Domain sub(Point(10,15,-1), Point(33,20,40));
+      Image part = VolReader<Image>::importVol("testchunked.vol", sub);
+      REQUIRE( part.domain().lowerBound() == sub.lowerBound() );
+      REQUIRE( part.domain().upperBound() == sub.upperBound() );
+      REQUIRE( (checkImage(part,image) == true)) ;
+      Image partz = VolReader<Image>::importVol("testz.vol", sub);
+      REQUIRE( (checkImage(partz,image) == true)) ;
+      Domain single(Point(16,16,16), Point(16,16,16));
+      Image one = VolReader<Image>::importVol("testchunked.vol", single);
+      REQUIRE( one(Point(16,16,16)) == image(Point(16,16,16)) );
+    }
+
+  SECTION("Testing chunked Vol with GenericWriter/GenericReader")
+    {
+      REQUIRE( GenericWriter<Image>::exportFile("testchunked.cvol", image) );
+      Image read = GenericReader<Image>::import("testchunked.cvol");
+      REQUIRE( (checkImage(image,read) == true)) ;
+    }
+
+  SECTION("Testing TiledImage on chunked Vol")
+    {
+      VolWriter<Image>::exportChunkedVol("testchunked.vol", image, 8);
+      typedef ImageFactoryFromVol<Image> Factory;
+      typedef ImageCacheReadPolicyFIFO<Image, Factory> ReadPolicy;
+      typedef ImageCacheWritePolicyWT<Image, Factory> WritePolicy;
+      typedef TiledImage<Image, Factory, ReadPolicy, WritePolicy> Tiled;
+      Factory factory("testchunked.vol");
+      REQUIRE( factory.domain().lowerBound() == domain.lowerBound() );
+      REQUIRE( factory.domain().upperBound() == domain.upperBound() );
+      ReadPolicy readPolicy(factory, 2);
+      WritePolicy writePolicy(factory);
+      Tiled tiled(factory, readPolicy, writePolicy, 4);
+      bool same = true;
+      for(auto p: domain)
+        same = same && ( tiled(p) == image(p) );
+      REQUIRE( same );
+    }
+
+  SECTION("Testing chunked Vol whose bricks do not match the header")
+    {
+      Domain small(Point(0,0,0), Point(7,7,6));
+      Image smallImage(small);
+      REQUIRE( VolWriter<Image>::exportChunkedVol("testchunked.vol", smallImage, 4) );
+      // Same number of bricks, but the upper ones now hold fewer voxels than expected.
+      std::ifstream in("testchunked.vol", std::ios::in | std::ios::binary);
+      std::string content( ( std::istreambuf_iterator<char>( in ) ),
+                           std::istreambuf_iterator<char>() );
+      in.close();
+      const std::size_t field = content.find("\nZ: 7\n");
+      REQUIRE( field != std::string::npos );
+      content.replace( field, 6, "\nZ: 8\n" );
+      std::ofstream out("testchunked.vol", std::ios::out | std::ios::binary);
+      out << content;
+      out.close();
+      REQUIRE_THROWS_AS( VolReader<Image>::importVol("testchunked.vol"), IOException );
+    }
+}
+
 /** @ingroup Tests **/
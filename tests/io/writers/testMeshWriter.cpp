@@ -29,6 +29,7 @@
 
 ///////////////////////////////////////////////////////////////////////////////
 #include <iostream>
+#include <sstream>
 #include "DGtal/base/Common.h"
 #include "DGtal/helpers/StdDefs.h" 
 //! [MeshWriterUseIncludes]
@@ -107,6 +108,49 @@ bool testMeshWriter()
   return nbok == nb;
 }
 
+/**
+ * Coordinates that do not fit in a double are written as the stream
+ * operator does.
+ */
+template <typename TPoint>
+bool testExactCoordinates( const TPoint & aPoint )
+{
+  Mesh<TPoint> aMesh;
+  aMesh.addVertex( aPoint );
+  std::ostringstream expected, exportOFF, exportPLY;
+  expected.precision( 25 );
+  exportOFF.precision( 25 );
+  expected << aPoint[ 0 ] << " " << aPoint[ 1 ] << " " << aPoint[ 2 ] << "\n";
+  MeshWriter<TPoint>::export2OFF( exportOFF, aMesh, false );
+  MeshWriter<TPoint>::export2PLY( exportPLY, aMesh, false );
+  trace.info() << expected.str();
+  return exportOFF.str().find( expected.str() ) != std::string::npos;
+}
+
+bool testMeshWriterNumberTypes()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+  trace.beginBlock ( "Testing coordinate types ..." );
+  typedef PointVector<3, DGtal::int64_t> Int64Point;
+  nbok += testExactCoordinates( Int64Point( ( DGtal::int64_t( 1 ) << 53 ) + 1,
+                                            - ( DGtal::int64_t( 1 ) << 62 ) - 3, 7 ) ) ? 1 : 0;
+  nb++;
+  typedef PointVector<3, long double> LongDoublePoint;
+  nbok += testExactCoordinates( LongDoublePoint( 0.1L, 1.0L / 3.0L, 1e300L * 1e300L ) ) ? 1 : 0;
+  nb++;
+#ifdef WITH_BIGINTEGER
+  typedef PointVector<3, DGtal::BigInteger> BigPoint;
+  DGtal::BigInteger big( "123456789012345678901234567890" );
+  nbok += testExactCoordinates( BigPoint( big, -big, 1 ) ) ? 1 : 0;
+  nb++;
+#endif
+  trace.info() << "(" << nbok << "/" << nb << ") "
+	       << "exact coordinates" << std::endl;
+  trace.endBlock();
+  return nbok == nb;
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // Standard services - public :
 
@@ -118,7 +162,7 @@ int main( int argc, char** argv )
     trace.info() << " " << argv[ i ];
   trace.info() << endl;
 
-  bool res = testMeshWriter(); // && ... other tests
+  bool res = testMeshWriter() && testMeshWriterNumberTypes(); // && ... other tests
   trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
   trace.endBlock();
   return res ? 0 : 1;
@@ -223,6 +223,76 @@ bool testSetFromImage()
   return nbok == nb;
 }
 
+/**
+ * Checks the direct (and possibly parallel) processing of large
+ * ImageContainerBySTLVector against a point by point scan.
+ */
+bool testLargeContiguousImages()
+{
+  typedef Z3i::Domain Domain3;
+  typedef Z3i::Point Point3;
+  typedef ImageContainerBySTLVector<Domain3,int> Image;
+  typedef ImageContainerBySTLVector<Domain3,double> RealImage;
+
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  trace.beginBlock ( "Testing large contiguous images ..." );
+
+  Domain3 d( Point3(-3,2,-7), Point3(61,38,20) );
+
+  Image image(d), imagePar(d);
+  imageFromFunctor(image, Norm1<Point3>());
+  imageFromFunctor(imagePar, Norm1<Point3>(), true);
+  bool ok = true;
+  for (Domain3::ConstIterator it = d.begin(), itEnd = d.end(); it != itEnd; ++it)
+    ok = ok && ( image(*it) == (int)(*it).norm1() )
+      && ( imagePar(*it) == image(*it) );
+  nbok += ok ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") imageFromFunctor" << std::endl;
+
+  RealImage image2(d);
+  imageFromImage(image2, const_cast<Image const&>(image));
+  ok = true;
+  for (Domain3::ConstIterator it = d.begin(), itEnd = d.end(); it != itEnd; ++it)
+    ok = ok && ( image2(*it) == (double)image(*it) );
+  nbok += ok ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") imageFromImage" << std::endl;
+
+  //points in the domain order
+  std::vector<Point3> expected, expected2, result, result2;
+  for (Domain3::ConstIterator it = d.begin(), itEnd = d.end(); it != itEnd; ++it)
+    {
+      if ( image(*it) <= 40 )
+        expected.push_back( *it );
+      if ( ( 20 <= image(*it) ) && ( image(*it) <= 40 ) )
+        expected2.push_back( *it );
+    }
+  setFromImage( image, std::back_inserter(result), 40 );
+  setFromImage( image, std::back_inserter(result2), 20, 40 );
+  nbok += ( ( result == expected ) && ( result2 == expected2 ) ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") setFromImage" << std::endl;
+
+  std::vector<Point3> points( d.begin(), d.end() ), result3, result4;
+  functors::IntervalThresholder<int> interval( 20, 40 );
+  functors::PointFunctorPredicate<Image, functors::IntervalThresholder<int> >
+    pred( image, interval );
+  setFromPointsRangeAndPredicate( points.begin(), points.end(),
+                                  std::back_inserter(result3), pred );
+  setFromPointsRangeAndPredicate( points.begin(), points.end(),
+                                  std::back_inserter(result4), pred, true );
+  nbok += ( ( result3 == expected2 ) && ( result4 == expected2 ) ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") setFromPointsRangeAndPredicate" << std::endl;
+
+  trace.endBlock();
+
+  return nbok == nb;
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // Standard services - public :
 
@@ -234,7 +304,8 @@ int main( int argc, char** argv )
     trace.info() << " " << argv[ i ];
   trace.info() << endl;
 
-  bool res = testImageFromSet() && testSetFromImage();
+  bool res = testImageFromSet() && testSetFromImage()
+    && testLargeContiguousImages();
   trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
   trace.endBlock();
   return res ? 0 : 1;
@@ -109,6 +109,37 @@ bool testHistogramGaussian2()
   return nbok == nb;
 }
 
+bool testHistogramMerge()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  trace.beginBlock ( "Testing bulk addValues and merge of histograms ..." );
+  std::vector<double> v( 200000 );
+  for ( auto & x : v ) x = getRandomNumber( -1.0, 1.0 );
+  Statistic<double> stat;
+  stat.addValues( v.begin(), v.end() );
+  Histogram<double> hist, hist1, hist2;
+  hist.init( 50, stat );
+  hist1.init( 50, stat );
+  hist2.init( 50, stat );
+  hist.addValues( v.begin(), v.end() );
+  hist1.addValues( v.begin(), v.begin() + 70000 );
+  for ( auto it = v.begin() + 70000; it != v.end(); ++it )
+    hist2.addValue( *it );
+  hist1 += hist2;
+  hist.terminate();
+  hist1.terminate();
+  bool same = true;
+  for ( unsigned int i = 0; i < hist.size(); ++i )
+    same = same && ( hist.nb( i ) == hist1.nb( i ) );
+  ++nb; nbok += same ? 1 : 0;
+  ++nb; nbok += hist.area() == v.size() ? 1 : 0;
+  trace.info() << "(" << nbok << "/" << nb << ") " << hist << std::endl;
+  trace.endBlock();
+  return nbok == nb;
+}
+
 
 ///////////////////////////////////////////////////////////////////////////////
 // Standard services - public :
@@ -119,7 +150,8 @@ int main( int, char** )
 
   bool res = testHistogramUniform()
     && testHistogramGaussian()
-    && testHistogramGaussian2();
+    && testHistogramGaussian2()
+    && testHistogramMerge();
   trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
 
   trace.endBlock();
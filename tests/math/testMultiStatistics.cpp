@@ -118,6 +118,31 @@ TEST_CASE( "Testing MultiStatistics" )
       REQUIRE( stats3.median(val) == ((val+1)/2) );            
     }
 
+  MultiStatistics part1 (100, true);
+  MultiStatistics part2 (100, true);
+  for(unsigned int i = 0; i< 100; i++)
+    {
+      for(unsigned int j = 0; j<= i; j++)
+        {
+          if ( j <= i/2 ) part1.addValue(i, i-j);
+          else            part2.addValue(i, i-j);
+        }
+    }
+  part1 += part2;
+  part1.terminate();
+
+  SECTION("Testing merge of MultiStatistics")
+    {
+      unsigned int val = 33;
+      REQUIRE( part1.samples(val) == val+1 );      
+      REQUIRE( part1.max(val) == val );      
+      REQUIRE( part1.maxIndice(val) == 0 );      
+      REQUIRE( part1.min(val) == 0 );      
+      REQUIRE( part1.minIndice(val) == val );      
+      REQUIRE( part1.mean(val) == val/2.0  );      
+      REQUIRE( part1.median(val) == ((val+1)/2) );            
+    }
+
 
 }
 
@@ -30,6 +30,8 @@
 ///////////////////////////////////////////////////////////////////////////////
 #include <iostream>
 #include <vector>
+#include <algorithm>
+#include <cmath>
 #include "DGtal/math/Statistic.h"
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -111,6 +113,93 @@ bool testStatisticsSaving()
   
   return nbok == nb;
 }
+/**
+ * Bulk accumulation, merge of partial statistics and approximate
+ * quantiles.
+ */
+bool testStatisticsMergeAndSketch()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+  
+  trace.beginBlock ( "Testing Statistics merge and quantile sketch ..." );
+
+  // Deterministic pseudo-random values in [0,1), spanning several blocks.
+  std::vector<double> v( 300000 );
+  DGtal::uint64_t seed = 12345;
+  for ( auto & x : v )
+    {
+      seed = seed * 6364136223846793005ULL + 1442695040888963407ULL;
+      x = static_cast<double>( seed >> 11 ) / 9007199254740992.0;
+    }
+  std::vector<double> sorted( v );
+  std::sort( sorted.begin(), sorted.end() );
+
+  Statistic<double> seq;
+  for ( auto x : v ) seq.addValue( x );
+  Statistic<double> bulk;
+  bulk.setQuantileSketch( 100.0 );
+  bulk.addValues( v.begin(), v.end() );
+  trace.info() << "bulk = " << bulk << std::endl;
+  ++nb; nbok += bulk.samples() == v.size() ? 1 : 0;
+  ++nb; nbok += ( bulk.min() == sorted.front() && bulk.max() == sorted.back() ) ? 1 : 0;
+  ++nb; nbok += std::fabs( bulk.mean() - seq.mean() ) < 1e-12 ? 1 : 0;
+  ++nb; nbok += std::fabs( bulk.variance() - seq.variance() ) < 1e-12 ? 1 : 0;
+
+  // Partial statistics accumulated separately, then merged.
+  Statistic<double> merged;
+  merged.setQuantileSketch( 100.0 );
+  for ( unsigned int k = 0; k < 3; ++k )
+    {
+      Statistic<double> part;
+      part.setQuantileSketch( 100.0 );
+      part.addValues( v.begin() + k * 100000, v.begin() + (k+1) * 100000 );
+      merged += part;
+    }
+  ++nb; nbok += merged.samples() == v.size() ? 1 : 0;
+  ++nb; nbok += std::fabs( merged.mean() - seq.mean() ) < 1e-12 ? 1 : 0;
+  ++nb; nbok += merged.hasQuantileSketch() ? 1 : 0;
+
+  // Approximate quantiles: values are uniform, hence the rank error
+  // is close to the value error.
+  const double orders[] = { 0.001, 0.01, 0.1, 0.5, 0.9, 0.99, 0.999 };
+  for ( double q : orders )
+    {
+      const double exact = sorted[ static_cast<std::size_t>( q * sorted.size() ) ];
+      const double e1 = std::fabs( bulk.quantile( q ) - exact );
+      const double e2 = std::fabs( merged.quantile( q ) - exact );
+      trace.info() << "q=" << q << " exact=" << exact
+                   << " err(bulk)=" << e1 << " err(merged)=" << e2 << std::endl;
+      ++nb; nbok += ( e1 < 0.005 && e2 < 0.005 ) ? 1 : 0;
+    }
+  ++nb; nbok += ( bulk.quantile( 0.0 ) == sorted.front() 
+                  && bulk.quantile( 1.0 ) == sorted.back() ) ? 1 : 0;
+  bulk.terminate();
+  ++nb; nbok += std::fabs( bulk.median() - sorted[ sorted.size() / 2 ] ) < 0.005 ? 1 : 0;
+
+  // Exact quantiles when samples are stored.
+  Statistic<double> stored( true );
+  stored.addValues( v.begin(), v.end() );
+  ++nb; nbok += stored.size() == v.size() ? 1 : 0;
+  ++nb; nbok += stored.quantile( 0.9 ) == sorted[ 270000 ] ? 1 : 0;
+  ++nb; nbok += stored.median() == sorted[ 150000 ] ? 1 : 0;
+
+  // No value to take a quantile from.
+  Statistic<double> empty( true );
+  Statistic<double> emptySketch;
+  emptySketch.setQuantileSketch( 100.0 );
+  Statistic<double> notStored;
+  notStored.addValue( 1.0 );
+  ++nb; nbok += std::isnan( empty.quantile( 0.5 ) ) ? 1 : 0;
+  ++nb; nbok += std::isnan( emptySketch.quantile( 0.5 ) ) ? 1 : 0;
+  ++nb; nbok += std::isnan( notStored.quantile( 0.5 ) ) ? 1 : 0;
+
+  trace.info() << "(" << nbok << "/" << nb << ") "
+         << "true == true" << std::endl;
+  trace.endBlock();
+  
+  return nbok == nb;
+}
 
 ///////////////////////////////////////////////////////////////////////////////
 // Standard services - public :
@@ -136,8 +225,11 @@ int main( int argc, char** argv )
   trace.emphase() << ( res2 ? "Passed." : "Error." ) << endl;
 
 
+  bool res3 = testStatisticsMergeAndSketch();
+  trace.emphase() << ( res3 ? "Passed." : "Error." ) << endl;
+
   trace.endBlock();
-  return (res &&res2) ? 0 : 1;
+  return (res && res2 && res3) ? 0 : 1;
 }
 //                                                                           //
 ///////////////////////////////////////////////////////////////////////////////
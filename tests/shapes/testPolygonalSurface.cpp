@@ -39,6 +39,11 @@
 #include "DGtal/graph/BreadthFirstVisitor.h"
 #include "DGtal/shapes/PolygonalSurface.h"
 #include "DGtal/shapes/MeshHelpers.h"
+#include "DGtal/shapes/Shapes.h"
+#include "DGtal/topology/SetOfSurfels.h"
+#include "DGtal/topology/DigitalSurface.h"
+#include "DGtal/topology/CanonicCellEmbedder.h"
+#include "DGtal/topology/helpers/Surfaces.h"
 ///////////////////////////////////////////////////////////////////////////////
 
 using namespace std;
@@ -207,6 +212,138 @@ SCENARIO( "PolygonalSurface< RealPoint3 > build tests", "[polysurf][build]" )
   }
 }
 
+SCENARIO( "PolygonalSurface< RealPoint3 > primal surface tests", "[polysurf][primal]" )
+{
+  typedef Z3i::KSpace                           KSpace;
+  typedef Z3i::Domain                           Domain;
+  typedef Z3i::DigitalSet                       DigitalSet;
+  typedef KSpace::Cell                          Cell;
+  typedef SetOfSurfels< KSpace >                SurfelSet;
+  typedef DigitalSurface< SurfelSet >           Surface;
+  typedef CanonicCellEmbedder< KSpace >         Embedder;
+  typedef Z3i::Point                            Point;
+  typedef PolygonalSurface< Embedder::Value >   PolygonMesh;
+  typedef std::map< Cell, PolygonMesh::Index >  CellMap;
+
+  Domain domain( Point( -8, -8, -8 ), Point( 8, 8, 8 ) );
+  KSpace K; K.init( domain.lowerBound(), domain.upperBound(), true );
+  DigitalSet aSet( domain );
+  Shapes< Domain >::addNorm2Ball( aSet, Point( -2, 0, 0 ), 4 );
+  Shapes< Domain >::addNorm2Ball( aSet, Point( 3, 1, 1 ), 3 );
+  SurfelAdjacency< 3 > surfAdj( true );
+  SurfelSet surfels( K, surfAdj );
+  Surfaces< KSpace >::sMakeBoundary( surfels.surfelSet(), K, aSet,
+                                     domain.lowerBound(), domain.upperBound() );
+  Surface dsurf( surfels );
+  Embedder embedder( K );
+
+  // Reference construction, one surfel after the other.
+  PolygonMesh  refmesh;
+  CellMap      refmap;
+  for ( auto&& s : dsurf )
+    for ( auto&& v : Surfaces< KSpace >::getPrimalVertices( K, s ) )
+      if ( ! refmap.count( v ) ) refmap[ v ] = refmesh.addVertex( embedder( v ) );
+  for ( auto&& s : dsurf ) {
+    auto vtcs = Surfaces< KSpace >::getPrimalVertices( K, s, true );
+    PolygonMesh::PolygonalFace face;
+    for ( auto&& v : vtcs ) face.push_back( refmap[ v ] );
+    refmesh.addPolygonalFace( face );
+  }
+  refmesh.build();
+
+  PolygonMesh polymesh;
+  CellMap     cellmap;
+  bool ok = MeshHelpers::digitalSurface2PrimalPolygonalSurface
+    ( dsurf, embedder, polymesh, cellmap );
+  GIVEN( "The primal polygonal surface of two intersecting balls" ) {
+    THEN( "It is built and has the same vertices and faces as the reference" ) {
+      REQUIRE( ok );
+      REQUIRE( polymesh.nbVertices() == refmesh.nbVertices() );
+      REQUIRE( polymesh.nbFaces() == dsurf.size() );
+      REQUIRE( polymesh.nbFaces() == refmesh.nbFaces() );
+      REQUIRE( cellmap == refmap );
+      bool same = true;
+      for ( auto v : polymesh )
+        same = same && ( polymesh.position( v ) == refmesh.position( v ) );
+      for ( PolygonMesh::Face f = 0; f < polymesh.nbFaces(); ++f )
+        same = same && ( polymesh.verticesAroundFace( f ) == refmesh.verticesAroundFace( f ) );
+      REQUIRE( same );
+      REQUIRE( polymesh.Euler() == refmesh.Euler() );
+    }
+  }
+}
+
+SCENARIO( "PolygonalSurface< RealPoint3 > dual surface tests", "[polysurf][dual]" )
+{
+  typedef Z3i::KSpace                           KSpace;
+  typedef Z3i::Domain                           Domain;
+  typedef Z3i::DigitalSet                       DigitalSet;
+  typedef KSpace::SCell                         SCell;
+  typedef SetOfSurfels< KSpace >                SurfelSet;
+  typedef DigitalSurface< SurfelSet >           Surface;
+  typedef CanonicCellEmbedder< KSpace >         Embedder;
+  typedef Z3i::Point                            Point;
+  typedef PolygonalSurface< Embedder::Value >   PolygonMesh;
+  typedef TriangulatedSurface< Embedder::Value > TriMesh;
+  typedef std::map< SCell, PolygonMesh::Index > VertexMap;
+
+  Domain domain( Point( -8, -8, -8 ), Point( 8, 8, 8 ) );
+  KSpace K; K.init( domain.lowerBound(), domain.upperBound(), true );
+  DigitalSet aSet( domain );
+  Shapes< Domain >::addNorm2Ball( aSet, Point( -2, 0, 0 ), 4 );
+  Shapes< Domain >::addNorm2Ball( aSet, Point( 3, 1, 1 ), 3 );
+  SurfelAdjacency< 3 > surfAdj( true );
+  SurfelSet surfels( K, surfAdj );
+  Surfaces< KSpace >::sMakeBoundary( surfels.surfelSet(), K, aSet,
+                                     domain.lowerBound(), domain.upperBound() );
+  Surface dsurf( surfels );
+  Embedder embedder( K );
+
+  // Reference construction, one face after the other.
+  PolygonMesh  refmesh;
+  VertexMap    refmap;
+  for ( auto&& s : dsurf ) refmap[ s ] = refmesh.addVertex( embedder( K.unsigns( s ) ) );
+  for ( auto&& f : dsurf.allClosedFaces() ) {
+    PolygonMesh::PolygonalFace face;
+    for ( auto&& v : dsurf.verticesAroundFace( f ) ) face.push_back( refmap[ v ] );
+    refmesh.addPolygonalFace( face );
+  }
+  refmesh.build();
+
+  GIVEN( "The dual polygonal surface of two intersecting balls" ) {
+    PolygonMesh polymesh;
+    VertexMap   vertexmap;
+    MeshHelpers::digitalSurface2DualPolygonalSurface( dsurf, embedder, polymesh, vertexmap );
+    THEN( "It has the same vertices and faces as the reference" ) {
+      REQUIRE( vertexmap == refmap );
+      REQUIRE( polymesh.nbVertices() == refmesh.nbVertices() );
+      REQUIRE( polymesh.nbFaces() == refmesh.nbFaces() );
+      bool same = true;
+      for ( PolygonMesh::Face f = 0; f < polymesh.nbFaces(); ++f )
+        same = same && ( polymesh.verticesAroundFace( f ) == refmesh.verticesAroundFace( f ) );
+      REQUIRE( same );
+    }
+  }
+  GIVEN( "The dual triangulated surface of two intersecting balls" ) {
+    TriMesh     trimesh;
+    VertexMap   vertexmap;
+    MeshHelpers::digitalSurface2DualTriangulatedSurface( dsurf, embedder, trimesh, vertexmap );
+    THEN( "Each face of the reference is a triangle or a fan around its barycenter" ) {
+      REQUIRE( vertexmap == refmap );
+      TriMesh::Index nbTriangles = 0;
+      TriMesh::Index nbVertices  = refmesh.nbVertices();
+      for ( PolygonMesh::Face f = 0; f < refmesh.nbFaces(); ++f ) {
+        auto n = refmesh.verticesAroundFace( f ).size();
+        nbTriangles += ( n == 3 ) ? 1 : n;
+        nbVertices  += ( n == 3 ) ? 0 : 1;
+      }
+      REQUIRE( trimesh.nbFaces() == nbTriangles );
+      REQUIRE( trimesh.nbVertices() == nbVertices );
+      REQUIRE( trimesh.Euler() == refmesh.Euler() );
+    }
+  }
+}
+
 SCENARIO( "PolygonalSurface< RealPoint3 > concept check tests", "[polysurf][concepts]" )
 {
   typedef PointVector<3,double>                 RealPoint;
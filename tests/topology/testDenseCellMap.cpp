@@ -0,0 +1,199 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testDenseCellMap.cpp
+ * @ingroup Tests
+ *
+ * @author DGtal development team (\c dgtal-devel@lists.gforge.liris.cnrs.fr )
+ *
+ * @date 2026/10/19
+ *
+ * Functions for testing class DenseCellMap.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <map>
+#include <vector>
+#include <cstdlib>
+#include "DGtal/base/Common.h"
+#include "DGtal/topology/KhalimskySpaceND.h"
+#include "DGtal/topology/CubicalComplex.h"
+#include "DGtal/topology/CubicalComplexFunctions.h"
+#include "DGtal/topology/DenseCellMap.h"
+#include "DGtalCatch.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+typedef KhalimskySpaceND<3>                     KSpace;
+typedef KSpace::Point                           Point;
+typedef KSpace::Cell                            Cell;
+typedef KSpace::Integer                         Integer;
+typedef std::map<Cell, CubicalCellData>         Map;
+typedef DenseCellMap<KSpace, CubicalCellData>   DenseMap;
+typedef CubicalComplex< KSpace, Map >           CC;
+typedef CubicalComplex< KSpace, DenseMap >      DenseCC;
+
+/// @return 'true' iff both complexes have the same cells and data.
+bool sameComplexes( const CC& complex, const DenseCC& dense )
+{
+  bool same = true;
+  for ( Dimension d = 0; d <= 3; ++d )
+    {
+      same = same && ( complex.nbCells( d ) == dense.nbCells( d ) );
+      for ( CC::CellMapConstIterator it = complex.begin( d ); it != complex.end( d ); ++it )
+        {
+          DenseCC::CellMapConstIterator itD = dense.findCell( d, it->first );
+          same = same && ( itD != dense.end( d ) )
+            && ( itD->second.data == it->second.data );
+        }
+    }
+  return same;
+}
+
+TEST_CASE( "DenseCellMap as an associative container" )
+{
+  KSpace K;
+  K.init( Point( -4, 0, 2 ), Point( 10, 7, 12 ), true );
+  srand( 0 );
+
+  SECTION( "Insertions, lookups and deletions of 2-cells" )
+    {
+      DenseMap dense( K, 2 );
+      std::map<Cell, CubicalCellData> reference;
+      for ( int n = 0; n < 2000; ++n )
+        {
+          Point p( -8 + rand() % 31, rand() % 17, 4 + rand() % 23 );
+          if ( ( p[ 0 ] & 1 ) + ( p[ 1 ] & 1 ) + ( p[ 2 ] & 1 ) != 2 ) continue;
+          Cell c = K.uCell( p );
+          if ( rand() % 4 == 0 )
+            REQUIRE( dense.erase( c ) == reference.erase( c ) );
+          else
+            {
+              bool inserted = reference.insert( std::make_pair( c, CubicalCellData( n ) ) ).second;
+              REQUIRE( dense.insert( std::make_pair( c, CubicalCellData( n ) ) ).second == inserted );
+            }
+        }
+      REQUIRE( dense.size() == reference.size() );
+      REQUIRE( dense.max_size() == 15 * 8 * 12 + 15 * 9 * 11 + 16 * 8 * 11 );
+      bool same = true;
+      for ( std::map<Cell, CubicalCellData>::const_iterator it = reference.begin();
+            it != reference.end(); ++it )
+        {
+          DenseMap::const_iterator itD = dense.find( it->first );
+          same = same && ( itD != dense.end() ) && ( itD->first == it->first )
+            && ( itD->second.data == it->second.data );
+        }
+      REQUIRE( same );
+      std::vector<Cell> visited;
+      for ( DenseMap::const_iterator it = dense.begin(); it != dense.end(); ++it )
+        visited.push_back( it->first );
+      REQUIRE( visited.size() == reference.size() );
+      std::sort( visited.begin(), visited.end() );
+      std::vector<Cell> cells;
+      for ( std::map<Cell, CubicalCellData>::const_iterator it = reference.begin();
+            it != reference.end(); ++it )
+        cells.push_back( it->first );
+      REQUIRE( visited == cells );
+      REQUIRE( dense.count( K.uCell( Point( 1, 1, 5 ) ) ) == 0 );
+      REQUIRE( dense.find( K.uCell( Point( 0, 0, 4 ) ) ) == dense.end() );
+      dense.clear();
+      REQUIRE( dense.empty() );
+      REQUIRE( dense.begin() == dense.end() );
+    }
+
+  SECTION( "Data are modified through iterators" )
+    {
+      DenseMap dense( K, 0 );
+      Cell c = K.uCell( Point( 0, 2, 4 ) );
+      dense[ c ].data = 3;
+      DenseMap::iterator it = dense.find( c );
+      REQUIRE( it != dense.end() );
+      it->second.data |= 4;
+      REQUIRE( dense[ c ].data == 7 );
+      REQUIRE( dense.erase( it ) == dense.end() );
+      REQUIRE( dense.size() == 0 );
+    }
+}
+
+TEST_CASE( "CubicalComplex with a DenseCellMap" )
+{
+  KSpace K;
+  K.init( Point( 0, 0, 0 ), Point( 15, 15, 15 ), true );
+  srand( 0 );
+  CC complex( K );
+  DenseCC dense( K );
+  std::vector<Cell> spels;
+  for ( int n = 0; n < 600; ++n )
+    {
+      Cell c = K.uSpel( Point( rand() % 16, rand() % 16, rand() % 16 ) );
+      spels.push_back( c );
+      complex.insertCell( c );
+      dense.insertCell( c );
+    }
+
+  SECTION( "Closure, boundary, interior and star" )
+    {
+      complex.close();
+      dense.close();
+      REQUIRE( sameComplexes( complex, dense ) );
+      REQUIRE( complex.euler() == dense.euler() );
+      CC bd = complex.boundary();
+      DenseCC bdD = dense.boundary();
+      REQUIRE( sameComplexes( bd, bdD ) );
+      CC in = complex.interior();
+      DenseCC inD = dense.interior();
+      REQUIRE( sameComplexes( in, inD ) );
+      CC st = complex.star( bd );
+      DenseCC stD = dense.star( bdD );
+      REQUIRE( sameComplexes( st, stD ) );
+      complex.open();
+      dense.open();
+      REQUIRE( sameComplexes( complex, dense ) );
+    }
+
+  SECTION( "Set operations" )
+    {
+      complex.close();
+      dense.close();
+      CC bd = complex.boundary();
+      DenseCC bdD = dense.boundary();
+      REQUIRE( sameComplexes( complex - bd, dense - bdD ) );
+      REQUIRE( sameComplexes( complex & bd, dense & bdD ) );
+      REQUIRE( sameComplexes( ~complex, ~dense ) );
+      REQUIRE( ( bdD <= dense ) );
+      REQUIRE( ( ( dense - bdD ) | bdD ) == dense );
+    }
+
+  SECTION( "Collapse" )
+    {
+      complex.close();
+      dense.close();
+      CC::DefaultCellMapIteratorPriority P;
+      DenseCC::DefaultCellMapIteratorPriority PD;
+      functions::collapse( complex, spels.begin(), spels.end(), P, true, true );
+      functions::collapse( dense, spels.begin(), spels.end(), PD, true, true );
+      REQUIRE( sameComplexes( complex, dense ) );
+      REQUIRE( complex.euler() == dense.euler() );
+    }
+}
+
+/** @ingroup Tests **/
@@ -61,7 +61,10 @@ Object3D(const typename TObject::DigitalTopology &dt)
   K.init( domain.lowerBound(),
       domain.upperBound(), true);
 
-  return TObject(dt, diamond_set);
+  TObject object(dt, diamond_set);
+  // isSimple uses the geodesic neighborhoods, to be checked against the tables.
+  object.unsetTable();
+  return object;
 }
 
 TEST_CASE("Check that each neighborhood point in 3D (26 points) has associated a bit in an unsigned integer (NeighborhoodConfiguration).", "[map][mask][3D]" )
@@ -225,6 +228,9 @@ struct Objects2D{
     shape_set.erase( Point( -1, -2 ) );
     obj8_4 = Object8_4( dt8_4, shape_set );
     obj4_8 = Object4_8( dt4_8, shape_set );
+    // isSimple uses the geodesic neighborhoods, to be checked against the tables.
+    obj8_4.unsetTable();
+    obj4_8.unsetTable();
   }
 
 };
@@ -812,6 +812,113 @@ bool testSetTable()
   return nbok == nb;
 
 }
+/**
+ * Compares the batch isSimple, with a table selected from the
+ * topology, to the per point isSimple with and without table.
+ */
+template <typename TObject>
+bool checkBatchSimple( const TObject & reference, const typename TObject::Domain & queries )
+{
+  TObject shape( reference );
+  TObject geodesic( reference );
+  geodesic.unsetTable();
+  if ( ! shape.setTableFromTopology() )
+    return false;
+  std::vector<typename TObject::Point> points( queries.begin(), queries.end() );
+  std::vector<bool> simple;
+  shape.isSimple( points.begin(), points.end(), std::back_inserter( simple ) );
+  bool ok = simple.size() == points.size();
+  for ( std::size_t i = 0; ok && i < points.size(); ++i )
+    ok = ( simple[ i ] == geodesic.isSimple( points[ i ] ) )
+      && ( simple[ i ] == reference.isSimple( points[ i ] ) )
+      && ( simple[ i ] == shape.isSimple( points[ i ] ) );
+  return ok;
+}
+
+/**
+ * Objects of a Jordan pair of metric adjacencies use their table
+ * without setTableFromTopology, also when copied and queried by
+ * several threads.
+ */
+template <typename TObject>
+bool checkAutomaticTable( const TObject & reference, const typename TObject::Domain & queries )
+{
+  TObject geodesic( reference );
+  geodesic.unsetTable();
+  std::vector<typename TObject::Point> points( queries.begin(), queries.end() );
+  const long nb = static_cast<long>( points.size() );
+  std::vector<unsigned char> simple( points.size() ), expected( points.size() );
+#ifdef WITH_OPENMP
+#pragma omp parallel for schedule(dynamic)
+#endif
+  for ( long i = 0; i < nb; ++i )
+    {
+      TObject copy( reference );
+      simple[ i ] = copy.isSimple( points[ i ] ) ? 1 : 0;
+    }
+  for ( long i = 0; i < nb; ++i )
+    expected[ i ] = geodesic.isSimple( points[ i ] ) ? 1 : 0;
+  return simple == expected;
+}
+
+bool testBatchSimple()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+  trace.beginBlock ( "Batch isSimple with tables selected from topology..." );
+  srand( 0 );
+
+  Z2i::Domain domain2( Z2i::Point( -20, -20 ), Z2i::Point( 20, 20 ) );
+  Z2i::DigitalSet set2( domain2 );
+  for ( auto p : domain2 )
+    if ( rand() % 3 != 0 ) set2.insert( p );
+  Z2i::Domain queries2( Z2i::Point( -19, -19 ), Z2i::Point( 19, 19 ) );
+  INBLOCK_TEST( checkBatchSimple( Z2i::Object4_8( Z2i::dt4_8, set2 ), queries2 ) );
+  INBLOCK_TEST( checkBatchSimple( Z2i::Object8_4( Z2i::dt8_4, set2 ), queries2 ) );
+
+  Z3i::Domain domain3( Z3i::Point( -8, -8, -8 ), Z3i::Point( 8, 8, 8 ) );
+  Z3i::DigitalSet set3( domain3 );
+  for ( auto p : domain3 )
+    if ( rand() % 3 != 0 ) set3.insert( p );
+  Z3i::Domain queries3( Z3i::Point( -4, -4, -4 ), Z3i::Point( 4, 4, 4 ) );
+  INBLOCK_TEST( checkBatchSimple( Z3i::Object26_6( Z3i::dt26_6, set3 ), queries3 ) );
+  INBLOCK_TEST( checkBatchSimple( Z3i::Object6_26( Z3i::dt6_26, set3 ), queries3 ) );
+  INBLOCK_TEST( checkAutomaticTable( Z2i::Object8_4( Z2i::dt8_4, set2 ), queries2 ) );
+  INBLOCK_TEST( checkAutomaticTable( Z3i::Object26_6( Z3i::dt26_6, set3 ), queries3 ) );
+
+  // No table for a non Jordan pair: batch queries check each point.
+  typedef DigitalTopology< Z3i::Adj6, Z3i::Adj6 > DT6_6;
+  typedef Object< DT6_6, Z3i::DigitalSet > Object6_6;
+  Z3i::Adj6 adj6;
+  DT6_6 dt6_6( adj6, adj6 );
+  Object6_6 shape6_6( dt6_6, set3 );
+  INBLOCK_TEST( ! shape6_6.setTableFromTopology() );
+  std::vector<bool> simple6_6;
+  std::vector<Z3i::Point> points( queries3.begin(), queries3.end() );
+  shape6_6.isSimple( points.begin(), points.end(), std::back_inserter( simple6_6 ) );
+  bool same = simple6_6.size() == points.size();
+  for ( std::size_t i = 0; same && i < points.size(); ++i )
+    same = ( simple6_6[ i ] == shape6_6.isSimple( points[ i ] ) );
+  INBLOCK_TEST( same );
+
+  // Dense configurations follow the order of the configuration masks.
+  Z3i::Object26_6 shape( Z3i::dt26_6, set3 );
+  auto masks = functions::mapZeroPointNeighborhoodToConfigurationMask<Z3i::Point>();
+  std::vector<unsigned char> image( 17 * 17 * 17, 0 );
+  for ( auto p : set3 )
+    image[ ( p[ 0 ] + 8 ) + 17 * ( p[ 1 ] + 8 ) + 289 * ( p[ 2 ] + 8 ) ] = 1;
+  bool sameCfg = true;
+  for ( auto p : queries3 )
+    sameCfg = sameCfg
+      && ( shape.getNeighborhoodConfigurationOccupancy( p, *masks )
+           == functions::getDenseNeighborhoodConfiguration
+           ( &image[ ( p[ 0 ] + 8 ) + 17 * ( p[ 1 ] + 8 ) + 289 * ( p[ 2 ] + 8 ) ], 17, 289 ) );
+  INBLOCK_TEST( sameCfg );
+
+  trace.endBlock();
+  return nbok == nb;
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // Standard services - public :
 
@@ -828,7 +935,8 @@ int main( int argc, char** argv )
     && testSimplePoints3D()
     && testSimplePoints2D()
     && testObjectGraph()
-    && testSetTable();
+    && testSetTable()
+    && testBatchSimple();
 
   trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
   trace.endBlock();
@@ -36,6 +36,7 @@
 // Cellular grid
 #include "DGtal/topology/CubicalComplex.h"
 #include "DGtal/topology/ParDirCollapse.h"
+#include "DGtal/topology/KhalimskyCellHashFunctions.h"
 // Shape construction
 #include "DGtal/shapes/GaussDigitizer.h"
 #include "DGtal/shapes/Shapes.h"
@@ -105,4 +106,47 @@ TEST_CASE( "Testing ParDirCollapse" )
     }
 }
 
+TEST_CASE( "Testing ParDirCollapse with a hash map" )
+{
+  typedef map<Cell, CubicalCellData>           Map;
+  typedef unordered_map<Cell, CubicalCellData> HashMap;
+  typedef CubicalComplex< KSpace, Map >        CC;
+  typedef CubicalComplex< KSpace, HashMap >    HashCC;
+  KSpace K;
+  CC complex ( K );
+  HashCC hashComplex ( K );
+  getComplex< CC, KSpace > ( complex, K );
+  getComplex< HashCC, KSpace > ( hashComplex, K );
+  int eulerBefore = complex.euler();
+
+  SECTION("The result does not depend on the order of the cells")
+    {
+      ParDirCollapse < CC > thinning ( K );
+      ParDirCollapse < HashCC > hashThinning ( K );
+      thinning.attach ( &complex );
+      hashThinning.attach ( &hashComplex );
+      unsigned int removed = thinning.eval ( 3 );
+      REQUIRE( removed != 0 );
+      REQUIRE( hashThinning.eval ( 3 ) == removed );
+      REQUIRE( eulerBefore == hashComplex.euler() );
+      bool same = true;
+      for ( Dimension d = 0; d <= 2; ++d )
+        {
+          same = same && ( complex.nbCells( d ) == hashComplex.nbCells( d ) );
+          for ( CC::CellMapConstIterator it = complex.begin( d ); it != complex.end( d ); ++it )
+            same = same && hashComplex.belongs( it->first );
+        }
+      REQUIRE( same );
+    }
+
+  SECTION("Testing ParDirCollapse::collapseSurface")
+    {
+      ParDirCollapse < HashCC > hashThinning ( K );
+      hashThinning.attach ( &hashComplex );
+      hashThinning.collapseSurface ();
+      REQUIRE( eulerBefore == hashComplex.euler() );
+      REQUIRE( hashComplex.nbCells( 2 ) == 0 );
+    }
+}
+
 /** @ingroup Tests **/
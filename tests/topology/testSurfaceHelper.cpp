@@ -315,6 +315,68 @@ bool testFindABel()
 }
 
 
+/**
+* Checks that Surfaces::parallelTrackBoundary and
+* Surfaces::sParallelMakeBoundary give the same surfels as the
+* sequential tracking and scanning.
+*/
+bool testParallelTrackBoundary()
+{
+  typedef Z3i::KSpace KSpace;
+  typedef Z3i::Point  Point;
+  typedef Z3i::SCell  SCell;
+  typedef Z3i::Domain Domain;
+  typedef DigitalSetBySTLSet<Domain> DigitalSet;
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+  trace.beginBlock ( "Testing Surfaces::parallelTrackBoundary." );
+  Point p1( -12, -10, -11 );
+  Point p2(  12,  10,  13 );
+  KSpace K; K.init( p1, p2, true );
+  Domain domain( p1, p2 );
+  DigitalSet aSet( domain );
+  Shapes<Domain>::addNorm2Ball( aSet, Point( -5, 0, 0 ), 4 );
+  Shapes<Domain>::addNorm1Ball( aSet, Point( 5, 1, 2 ), 5 );
+  Shapes<Domain>::addNorm2Ball( aSet, Point( 0, 0, 11 ), 3 );
+
+  std::set<SCell> bdry;
+  Surfaces<KSpace>::sMakeBoundary( bdry, K, aSet, p1, p2 );
+  const unsigned int slabs[] = { 0, 1, 3, 7, 100 };
+  for ( unsigned int i = 0; i < 5; ++i )
+    {
+      std::vector<SCell> bels;
+      Surfaces<KSpace>::sParallelMakeBoundary( bels, K, aSet, p1, p2, slabs[ i ] );
+      ++nb; nbok += ( bels.size() == bdry.size() )
+              && std::equal( bels.begin(), bels.end(), bdry.begin() ) ? 1 : 0;
+      trace.info() << "(" << nbok << "/" << nb << ") "
+                   << bels.size() << " bels with " << slabs[ i ] << " slabs"
+                   << " (should be " << bdry.size() << ")" << std::endl;
+    }
+
+  for ( unsigned int a = 0; a < 2; ++a )
+    {
+      SurfelAdjacency<3> SAdj( a == 0 );
+      unsigned int j = 0;
+      for ( std::set<SCell>::const_iterator it = bdry.begin(); it != bdry.end(); ++it, ++j )
+        {
+          if ( j % 150 != 0 ) continue;
+          std::set<SCell> surf, psurf, csurf, pcsurf;
+          Surfaces<KSpace>::trackBoundary( surf, K, SAdj, aSet, *it );
+          Surfaces<KSpace>::parallelTrackBoundary( psurf, K, SAdj, aSet, *it );
+          Surfaces<KSpace>::trackClosedBoundary( csurf, K, SAdj, aSet, *it );
+          Surfaces<KSpace>::parallelTrackBoundary( pcsurf, K, SAdj, aSet, *it, true );
+          ++nb; nbok += ( surf == psurf ) ? 1 : 0;
+          ++nb; nbok += ( csurf == pcsurf ) ? 1 : 0;
+          trace.info() << "(" << nbok << "/" << nb << ") "
+                       << psurf.size() << " surfels from " << *it
+                       << " (should be " << surf.size() << ")" << std::endl;
+        }
+    }
+  trace.endBlock();
+  return nbok == nb;
+}
+
+
 ///////////////////////////////////////////////////////////////////////////////
 // Standard services - public :
 
@@ -327,7 +389,8 @@ int main( int argc, char** argv )
   trace.info() << endl;
 
   bool res = testComputeInterior()
-    && testFindABel< KhalimskySpaceND<3,int> >()  && test3dSurfaceHelper();
+    && testFindABel< KhalimskySpaceND<3,int> >()  && test3dSurfaceHelper()
+    && testParallelTrackBoundary();
   trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
   trace.endBlock();
   return res ? 0 : 1;
@@ -0,0 +1,159 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testSurfelMarkSet.cpp
+ * @ingroup Tests
+ *
+ * @author DGtal development team (\c dgtal-devel@lists.gforge.liris.cnrs.fr )
+ *
+ * @date 2026/10/19
+ *
+ * Functions for testing class SurfelMarkSet.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <set>
+#include <vector>
+#include <algorithm>
+#include <cstdlib>
+#include "DGtal/base/Common.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/topology/KhalimskySpaceND.h"
+#include "DGtal/topology/SurfelMarkSet.h"
+#include "DGtal/topology/LightImplicitDigitalSurface.h"
+#include "DGtal/topology/helpers/Surfaces.h"
+#include "DGtal/graph/BreadthFirstVisitor.h"
+#include "DGtalCatch.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+typedef Z3i::KSpace                 KSpace;
+typedef KSpace::Point               Point;
+typedef KSpace::SCell               SCell;
+typedef SurfelMarkSet<KSpace>       MarkSet;
+
+/// Random insertions/deletions compared with a std::set.
+bool sameAsSet( const KSpace & K, MarkSet & marks )
+{
+  std::set<SCell> reference;
+  const Point lo = K.lowerBound();
+  const Point up = K.upperBound();
+  for ( int n = 0; n < 3000; ++n )
+    {
+      Point p;
+      for ( Dimension j = 0; j < 3; ++j )
+        p[ j ] = 2 * lo[ j ] + rand() % ( 2 * ( up[ j ] - lo[ j ] ) + 3 );
+      const Dimension k = rand() % 3;
+      for ( Dimension j = 0; j < 3; ++j )
+        if ( ( ( p[ j ] & 1 ) != 0 ) == ( j == k ) ) p[ j ] += ( p[ j ] < 2 * up[ j ] + 1 ) ? 1 : -1;
+      const SCell s = K.sCell( p, rand() % 2 == 0 );
+      if ( ! K.sIsSurfel( s ) ) continue;
+      if ( rand() % 4 == 0 )
+        {
+          if ( marks.erase( s ) != reference.erase( s ) ) return false;
+        }
+      else
+        {
+          const bool inserted = reference.insert( s ).second;
+          if ( marks.insert( s ).second != inserted ) return false;
+          if ( *( marks.find( s ) ) != s ) return false;
+        }
+    }
+  if ( marks.size() != reference.size() ) return false;
+  for ( std::set<SCell>::const_iterator it = reference.begin(); it != reference.end(); ++it )
+    if ( marks.count( *it ) != 1 ) return false;
+  std::vector<SCell> visited( marks.begin(), marks.end() );
+  std::sort( visited.begin(), visited.end() );
+  return ( visited.size() == reference.size() )
+    && std::equal( visited.begin(), visited.end(), reference.begin() );
+}
+
+TEST_CASE( "SurfelMarkSet as a set of surfels" )
+{
+  srand( 0 );
+
+  SECTION( "Bitmap of a bounded space" )
+    {
+      KSpace K;
+      K.init( Point( -4, 0, 2 ), Point( 10, 7, 12 ), true );
+      MarkSet marks( K );
+      REQUIRE( marks.isDense() );
+      REQUIRE( marks.empty() );
+      REQUIRE( sameAsSet( K, marks ) );
+      // bounding surfels of the space
+      const SCell s1 = K.sCell( Point( -8, 1, 5 ), true );
+      const SCell s2 = K.sCell( Point( 21, 15, 26 ), false );
+      marks.insert( s1 );
+      marks.insert( s2 );
+      REQUIRE( *( marks.find( s1 ) ) == s1 );
+      REQUIRE( *( marks.find( s2 ) ) == s2 );
+      MarkSet::ConstIterator it = marks.find( s2 );
+      marks.erase( it );
+      REQUIRE( marks.count( s2 ) == 0 );
+      marks.clear();
+      REQUIRE( marks.empty() );
+      REQUIRE( marks.begin() == marks.end() );
+    }
+
+  SECTION( "std::set fallback" )
+    {
+      KSpace K;
+      K.init( Point( -4, 0, 2 ), Point( 10, 7, 12 ), true );
+      MarkSet marks;
+      REQUIRE( ! marks.isDense() );
+      REQUIRE( sameAsSet( K, marks ) );
+      KSpace bigK;
+      bigK.init( Point::diagonal( -100000 ), Point::diagonal( 100000 ), true );
+      MarkSet bigMarks( bigK );
+      REQUIRE( ! bigMarks.isDense() );
+      REQUIRE( bigMarks.isValid() );
+    }
+}
+
+TEST_CASE( "LightImplicitDigitalSurface visited with a SurfelMarkSet" )
+{
+  typedef Z3i::Domain Domain;
+  typedef Z3i::DigitalSet DigitalSet;
+  typedef LightImplicitDigitalSurface<KSpace, DigitalSet> Surface;
+  Domain domain( Point( -6, -6, -6 ), Point( 6, 6, 6 ) );
+  DigitalSet ball( domain );
+  for ( Domain::ConstIterator it = domain.begin(); it != domain.end(); ++it )
+    if ( (*it).dot( *it ) <= 25 ) ball.insertNew( *it );
+  KSpace K;
+  K.init( domain.lowerBound(), domain.upperBound(), true );
+  const SCell bel = Surfaces<KSpace>::findABel( K, ball, 10000 );
+  Surface surface( K, ball, SurfelAdjacency<3>( true ), bel );
+
+  // visit with a std::set as marks
+  BreadthFirstVisitor<Surface> visitor( surface, bel );
+  std::set<SCell> reference;
+  while ( ! visitor.finished() )
+    {
+      reference.insert( visitor.current().first );
+      visitor.expand();
+    }
+  std::set<SCell> visited( surface.begin(), surface.end() );
+  REQUIRE( surface.nbSurfels() == reference.size() );
+  REQUIRE( visited == reference );
+}
+
+/** @ingroup Tests **/